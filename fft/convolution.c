@@ -16,39 +16,132 @@
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
 #include "fft.h"
+#include "thread_support.h"
+
+/* coefficient size (in limbs) from which the convolution is threaded */
+#define FFT_CONVOLUTION_PARALLEL_LIMBS 32
+
+/*
+   Without the matrix Fourier algorithm the two forward transforms, the
+   pointwise products and the final scaling are independent of each other
+   across coefficients, so they are distributed over threads here. As
+   elsewhere in the FFT, t1, t2, s1 and tt provide scratch space for each
+   of flint_get_num_threads() threads.
+*/
+typedef struct
+{
+   mp_limb_t ** ii;
+   mp_limb_t ** jj;
+   slong n;
+   slong w;
+   slong limbs;
+   slong depth;
+   slong trunc;
+   slong nblocks;
+   mp_limb_t ** t1;
+   mp_limb_t ** t2;
+   mp_limb_t ** s1;
+   mp_limb_t ** tt;
+} fft_conv_arg_t;
+
+static void
+_fft_conv_fft_worker(slong i, fft_conv_arg_t * arg)
+{
+   fft_truncate_sqrt2(i == 0 ? arg->ii : arg->jj, arg->n, arg->w,
+                      arg->t1 + i, arg->t2 + i, arg->s1 + i, arg->trunc);
+}
+
+static void
+_fft_conv_pointwise_worker(slong b, fft_conv_arg_t * arg)
+{
+   mp_limb_t ** ii = arg->ii, ** jj = arg->jj;
+   slong j, j0, j1, limbs = arg->limbs;
+
+   j0 = (b*arg->trunc)/arg->nblocks;
+   j1 = ((b + 1)*arg->trunc)/arg->nblocks;
+
+   for (j = j0; j < j1; j++)
+   {
+      mpn_normmod_2expp1(ii[j], limbs);
+      if (ii != jj) mpn_normmod_2expp1(jj[j], limbs);
+
+      fft_mulmod_2expp1(ii[j], ii[j], jj[j], arg->n, arg->w, arg->tt[b]);
+   }
+}
+
+static void
+_fft_conv_scale_worker(slong b, fft_conv_arg_t * arg)
+{
+   mp_limb_t ** ii = arg->ii;
+   slong j, j0, j1, limbs = arg->limbs;
+
+   j0 = (b*arg->trunc)/arg->nblocks;
+   j1 = ((b + 1)*arg->trunc)/arg->nblocks;
+
+   for (j = j0; j < j1; j++)
+   {
+      mpn_div_2expmod_2expp1(ii[j], ii[j], limbs, arg->depth + 2);
+      mpn_normmod_2expp1(ii[j], limbs);
+   }
+}
 
 void fft_convolution(mp_limb_t ** ii, mp_limb_t ** jj, slong depth, 
                               slong limbs, slong trunc, mp_limb_t ** t1, 
                           mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t ** tt)
 {
-   slong n = (WORD(1)<<depth), j;
+   slong n = (WORD(1)<<depth);
    slong w = (limbs*FLINT_BITS)/n;
    slong sqrt = (WORD(1)<<(depth/2));
    
    if (depth <= 6)
    {
+      fft_conv_arg_t arg;
+      slong nthreads = flint_get_num_threads();
+
       trunc = 2*((trunc + 1)/2);
-      
-      fft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
-   
-      if (ii != jj)
-         fft_truncate_sqrt2(jj, n, w, t1, t2, s1, trunc);
 
-      for (j = 0; j < trunc; j++)
+      arg.ii = ii;
+      arg.jj = jj;
+      arg.n = n;
+      arg.w = w;
+      arg.limbs = limbs;
+      arg.depth = depth;
+      arg.trunc = trunc;
+      arg.t1 = t1;
+      arg.t2 = t2;
+      arg.s1 = s1;
+      arg.tt = tt;
+
+      /* only worth it when the coefficients are large */
+      if (limbs < FFT_CONVOLUTION_PARALLEL_LIMBS)
+         nthreads = 1;
+
+      if (ii != jj && nthreads >= 2)
+         flint_parallel_do((do_func_t) _fft_conv_fft_worker, &arg, 2,
+                                                 2, FLINT_PARALLEL_UNIFORM);
+      else
       {
-         mpn_normmod_2expp1(ii[j], limbs);
-         if (ii != jj) mpn_normmod_2expp1(jj[j], limbs);
-         
-         fft_mulmod_2expp1(ii[j], ii[j], jj[j], n, w, *tt);
+         fft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+
+         if (ii != jj)
+            fft_truncate_sqrt2(jj, n, w, t1, t2, s1, trunc);
       }
 
+      arg.nblocks = FLINT_MIN(nthreads, trunc);
+
+      if (arg.nblocks > 1)
+         flint_parallel_do((do_func_t) _fft_conv_pointwise_worker, &arg,
+                             arg.nblocks, arg.nblocks, FLINT_PARALLEL_UNIFORM);
+      else
+         _fft_conv_pointwise_worker(0, &arg);
+
       ifft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
 
-      for (j = 0; j < trunc; j++)
-      {
-         mpn_div_2expmod_2expp1(ii[j], ii[j], limbs, depth + 2);
-         mpn_normmod_2expp1(ii[j], limbs);
-      }
+      if (arg.nblocks > 1)
+         flint_parallel_do((do_func_t) _fft_conv_scale_worker, &arg,
+                             arg.nblocks, arg.nblocks, FLINT_PARALLEL_UNIFORM);
+      else
+         _fft_conv_scale_worker(0, &arg);
    } else
    {
       trunc = 2*sqrt*((trunc + 2*sqrt - 1)/(2*sqrt));
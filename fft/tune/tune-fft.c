@@ -13,12 +13,347 @@
 #include <stdlib.h>
 #include <gmp.h>
 #include <time.h>
+#include <math.h>
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+#include "fmpz_poly.h"
+#include "fmpz_mat.h"
+#include "fmpz_mpoly.h"
 
+/*
+    Crossovers between two algorithms, alg = 0 being the one used for
+    small sizes. A tune function runs the given algorithm once on operands
+    of size n, which have been set up by the caller in arg.
+*/
+typedef void (* tune_func)(void * arg, slong n, int alg);
+
+/* time per call in seconds, taken over at least 10ms */
+static double
+tune_time(tune_func f, void * arg, slong n, int alg)
+{
+    clock_t start;
+    double elapsed;
+    slong i, reps = 1;
+
+    while (1)
+    {
+        start = clock();
+        for (i = 0; i < reps; i++)
+            f(arg, n, alg);
+        elapsed = ((double) (clock() - start)) / CLOCKS_PER_SEC;
+
+        if (elapsed >= 0.01)
+            return elapsed / reps;
+
+        reps *= 2;
+    }
+}
+
+/*
+    Smallest n in [lo, hi) from which alg = 1 beats alg = 0, also at the
+    next size tried, to avoid being misled by noise. Sizes grow by a
+    factor of ratio, and at least by one. Returns hi if there is no
+    crossover in the range.
+*/
+static slong
+tune_crossover(tune_func f, void * arg, slong lo, slong hi, double ratio)
+{
+    slong n, next;
+    int won = 0;
+
+    for (n = lo; n < hi; n = next)
+    {
+        next = FLINT_MAX(n + 1, (slong) (n * ratio));
+
+        if (tune_time(f, arg, n, 1) < tune_time(f, arg, n, 0))
+        {
+            if (won)
+                return lo;
+            won = 1;
+            lo = n;
+        }
+        else
+            won = 0;
+    }
+
+    return hi;
+}
+
+typedef struct
+{
+    mp_ptr a, b, r;
+    nmod_t mod;
+}
+tune_nmod_poly_struct;
+
+#if FLINT64
+static void
+tune_nmod_poly_mul(void * varg, slong n, int alg)
+{
+    tune_nmod_poly_struct * arg = (tune_nmod_poly_struct *) varg;
+
+    if (alg == 0)
+        _nmod_poly_mul_KS4(arg->r, arg->a, n, arg->b, n, arg->mod);
+    else
+        _nmod_poly_mul_fft_small(arg->r, arg->a, n, arg->b, n, arg->mod);
+}
+#endif
+
+static slong
+tune_nmod_poly_fft_small(flint_rand_t state, flint_bitcnt_t bits, slong dflt)
+{
+#if FLINT64
+    tune_nmod_poly_struct arg[1];
+    slong hi = 100000, res;
+
+    nmod_init(&arg->mod, n_randprime(state, bits, 0));
+    arg->a = _nmod_vec_init(4*hi);
+    arg->b = arg->a + hi;
+    arg->r = arg->b + hi;
+    _nmod_vec_randtest(arg->a, state, 2*hi, arg->mod);
+
+    res = tune_crossover(tune_nmod_poly_mul, arg, 500, hi, 1.2);
+
+    _nmod_vec_clear(arg->a);
+    return res;
+#else
+    return dflt;
+#endif
+}
+
+typedef struct
+{
+    nmod_mat_t A, B, C;
+}
+tune_nmod_mat_struct;
+
+static void
+tune_nmod_mat_mul(void * varg, slong n, int alg)
+{
+    tune_nmod_mat_struct * arg = (tune_nmod_mat_struct *) varg;
+    nmod_mat_t A, B, C;
+
+    nmod_mat_window_init(A, arg->A, 0, 0, n, n);
+    nmod_mat_window_init(B, arg->B, 0, 0, n, n);
+    nmod_mat_window_init(C, arg->C, 0, 0, n, n);
+
+    if (alg == 0)
+        nmod_mat_mul_classical(C, A, B);
+    else
+        nmod_mat_mul_strassen(C, A, B);
+
+    nmod_mat_window_clear(A);
+    nmod_mat_window_clear(B);
+    nmod_mat_window_clear(C);
+}
+
+static slong
+tune_nmod_mat_strassen(flint_rand_t state, mp_limb_t modulus)
+{
+    tune_nmod_mat_struct arg[1];
+    slong hi = 1000, res;
+
+    nmod_mat_init(arg->A, hi, hi, modulus);
+    nmod_mat_init(arg->B, hi, hi, modulus);
+    nmod_mat_init(arg->C, hi, hi, modulus);
+    nmod_mat_randfull(arg->A, state);
+    nmod_mat_randfull(arg->B, state);
+
+    res = tune_crossover(tune_nmod_mat_mul, arg, 64, hi, 1.2);
+
+    nmod_mat_clear(arg->A);
+    nmod_mat_clear(arg->B);
+    nmod_mat_clear(arg->C);
+    return res;
+}
+
+typedef struct
+{
+    fmpz * a, * b, * r;
+    int fast_alg;   /* 0 for KS, 1 for SS, 2 for multi_mod */
+}
+tune_fmpz_poly_struct;
+
+static void
+tune_fmpz_poly_mul(void * varg, slong n, int alg)
+{
+    tune_fmpz_poly_struct * arg = (tune_fmpz_poly_struct *) varg;
+
+    if (arg->fast_alg == 0)
+    {
+        if (alg == 0)
+            _fmpz_poly_mul_classical(arg->r, arg->a, n, arg->b, n);
+        else
+            _fmpz_poly_mul_KS(arg->r, arg->a, n, arg->b, n);
+    }
+    else if (arg->fast_alg == 1)
+    {
+        if (alg == 0)
+            _fmpz_poly_mul_karatsuba(arg->r, arg->a, n, arg->b, n);
+        else
+            _fmpz_poly_mul_SS(arg->r, arg->a, n, arg->b, n);
+    }
+    else
+    {
+        if (alg == 0)
+            _fmpz_poly_mul_KS(arg->r, arg->a, n, arg->b, n);
+        else
+            _fmpz_poly_mul_multi_mod(arg->r, arg->a, n, arg->b, n);
+    }
+}
+
+static slong
+tune_fmpz_poly(flint_rand_t state, flint_bitcnt_t bits, int fast_alg)
+{
+    tune_fmpz_poly_struct arg[1];
+    slong i, lo = 2, hi = 64, res;
+    double ratio = 1.0;
+
+    /* multi_mod only pays off for long polynomials */
+    if (fast_alg == 2)
+    {
+        lo = 500;
+        hi = 20000;
+        ratio = 1.2;
+    }
+
+    arg->a = _fmpz_vec_init(4*hi);
+    arg->b = arg->a + hi;
+    arg->r = arg->b + hi;
+    arg->fast_alg = fast_alg;
+    for (i = 0; i < 2*hi; i++)
+        fmpz_randbits(arg->a + i, state, bits);
+
+    res = tune_crossover(tune_fmpz_poly_mul, arg, lo, hi, ratio);
+
+    _fmpz_vec_clear(arg->a, 4*hi);
+    return res;
+}
+
+typedef struct
+{
+    fmpz_mat_t A, B, C;
+    flint_bitcnt_t bits;
+    int fast_alg;   /* 0 for strassen, 1 for multi_mod */
+}
+tune_fmpz_mat_struct;
+
+static void
+tune_fmpz_mat_mul(void * varg, slong n, int alg)
+{
+    tune_fmpz_mat_struct * arg = (tune_fmpz_mat_struct *) varg;
+    fmpz_mat_t A, B, C;
+
+    fmpz_mat_window_init(A, arg->A, 0, 0, n, n);
+    fmpz_mat_window_init(B, arg->B, 0, 0, n, n);
+    fmpz_mat_window_init(C, arg->C, 0, 0, n, n);
+
+    if (alg == 0)
+        fmpz_mat_mul_classical_inline(C, A, B);
+    else if (arg->fast_alg == 0)
+        fmpz_mat_mul_strassen(C, A, B);
+    else
+        _fmpz_mat_mul_multi_mod(C, A, B, 1,
+                                  2*arg->bits + 1 + FLINT_BIT_COUNT(n));
+
+    fmpz_mat_window_clear(A);
+    fmpz_mat_window_clear(B);
+    fmpz_mat_window_clear(C);
+}
+
+static slong
+tune_fmpz_mat(flint_rand_t state, flint_bitcnt_t bits, int fast_alg)
+{
+    tune_fmpz_mat_struct arg[1];
+    slong hi = 100, res;
+
+    fmpz_mat_init(arg->A, hi, hi);
+    fmpz_mat_init(arg->B, hi, hi);
+    fmpz_mat_init(arg->C, hi, hi);
+    fmpz_mat_randbits(arg->A, state, bits);
+    fmpz_mat_randbits(arg->B, state, bits);
+    arg->bits = bits;
+    arg->fast_alg = fast_alg;
+
+    res = tune_crossover(tune_fmpz_mat_mul, arg, 2, hi, 1.0);
+
+    fmpz_mat_clear(arg->A);
+    fmpz_mat_clear(arg->B);
+    fmpz_mat_clear(arg->C);
+    return res;
+}
+
+/*
+    Two random bivariate polynomials with len terms whose product has a
+    dense size of about n times len^2 terms.
+*/
+typedef struct
+{
+    fmpz_mpoly_ctx_t ctx;
+    fmpz_mpoly_t A, B, C;
+    flint_rand_t state;
+    slong len, n;
+}
+tune_fmpz_mpoly_struct;
+
+static void
+tune_fmpz_mpoly_mul(void * varg, slong n, int alg)
+{
+    tune_fmpz_mpoly_struct * arg = (tune_fmpz_mpoly_struct *) varg;
+
+    if (n != arg->n)
+    {
+        /* (2 bound - 1)^2 = n len^2 */
+        ulong bound = (ulong) (arg->len * sqrt((double) n) + 1)/2 + 1;
+
+        fmpz_mpoly_randtest_bound(arg->B, arg->state, arg->len, 20, bound,
+                                                                   arg->ctx);
+        fmpz_mpoly_randtest_bound(arg->C, arg->state, arg->len, 20, bound,
+                                                                   arg->ctx);
+        arg->n = n;
+    }
+
+    if (alg == 0)
+        fmpz_mpoly_mul_array(arg->A, arg->B, arg->C, arg->ctx);
+    else
+        fmpz_mpoly_mul_johnson(arg->A, arg->B, arg->C, arg->ctx);
+}
+
+/* the density ratio from which the heap beats the array method */
+static slong
+tune_fmpz_mpoly(flint_rand_t state)
+{
+    tune_fmpz_mpoly_struct arg[1];
+    slong res;
+
+    fmpz_mpoly_ctx_init(arg->ctx, 2, ORD_LEX);
+    fmpz_mpoly_init(arg->A, arg->ctx);
+    fmpz_mpoly_init(arg->B, arg->ctx);
+    fmpz_mpoly_init(arg->C, arg->ctx);
+    flint_randinit(arg->state);
+    arg->len = 200;
+    arg->n = -1;
+
+    res = tune_crossover(tune_fmpz_mpoly_mul, arg, 1, 200, 1.2);
+
+    flint_randclear(arg->state);
+    fmpz_mpoly_clear(arg->A, arg->ctx);
+    fmpz_mpoly_clear(arg->B, arg->ctx);
+    fmpz_mpoly_clear(arg->C, arg->ctx);
+    fmpz_mpoly_ctx_clear(arg->ctx);
+    return res;
+}
+
+/*
+    Writes fft_tuning.h to stdout, or to the file given as argument. Apart
+    from the FFT tables, this contains the crossovers of various multiplication
+    algorithms in other modules.
+*/
 int
-main(void)
+main(int argc, char ** argv)
 {
     flint_bitcnt_t depth, w, depth1, w1;
     clock_t start, end;
@@ -28,6 +363,12 @@ main(void)
 
     FLINT_TEST_INIT(state);
 
+    if (argc > 1 && freopen(argv[1], "w", stdout) == NULL)
+    {
+        flint_printf("Unable to open %s\n", argv[1]);
+        return 1;
+    }
+
     flint_printf("/* fft_tuning.h -- autogenerated by tune-fft */\n\n");
     flint_printf("#ifndef FFT_TUNING_H\n");
     flint_printf("#define FFT_TUNING_H\n\n");
@@ -162,7 +503,8 @@ main(void)
             }
 
             flint_printf("%wd", best_off); 
-            if (w != 2) flint_printf(", "); fflush(stdout);
+            if (w != 2) flint_printf(", ");
+            fflush(stdout);
 
             flint_free(i1);
         }
@@ -173,6 +515,51 @@ main(void)
     flint_printf("#define FFT_N_NUM %wd\n\n", 2*(depth - 12) + 1);
     
     flint_printf("#define FFT_MULMOD_2EXPP1_CUTOFF %wd\n\n", ((mp_limb_t) 1 << best_d)*best_w/(2*FLINT_BITS));
+
+    flint_printf("/* crossovers in other modules */\n\n");
+    fflush(stdout);
+
+    /* single prime for a 20 bit modulus, several for a 50 bit one */
+    flint_printf("#define NMOD_POLY_FFT_SMALL_CUTOFF1 %wd\n\n",
+                                      tune_nmod_poly_fft_small(state, 20, 6000));
+    fflush(stdout);
+    flint_printf("#define NMOD_POLY_FFT_SMALL_CUTOFF2 %wd\n\n",
+                                      tune_nmod_poly_fft_small(state, 50, 3000));
+    fflush(stdout);
+
+    flint_printf("#define NMOD_MAT_MUL_STRASSEN_CUTOFF %wd\n\n",
+                     tune_nmod_mat_strassen(state, n_randprime(state, FLINT_BITS, 0)));
+    fflush(stdout);
+    flint_printf("#define NMOD_MAT_MUL_STRASSEN_SMALL_CUTOFF %wd\n\n",
+                     tune_nmod_mat_strassen(state, n_randprime(state, 11, 0)));
+    fflush(stdout);
+
+    /* these are only used for coefficients of more than one limb */
+    flint_printf("#define FMPZ_POLY_MUL_CLASSICAL_CUTOFF %wd\n\n",
+                     tune_fmpz_poly(state, FLINT_BITS + FLINT_BITS/2, 0));
+    fflush(stdout);
+    flint_printf("#define FMPZ_POLY_MUL_KARATSUBA_CUTOFF %wd\n\n",
+                     tune_fmpz_poly(state, 16*FLINT_BITS, 1));
+    fflush(stdout);
+    /* multi_mod is used when the coefficients total at most 32 limbs */
+    flint_printf("#define FMPZ_POLY_MUL_MULTI_MOD_CUTOFF %wd\n\n",
+                     tune_fmpz_poly(state, 8*FLINT_BITS, 2));
+    fflush(stdout);
+
+    /* strassen is only used for entries of at least 500 bits */
+    flint_printf("#define FMPZ_MAT_MUL_STRASSEN_CUTOFF %wd\n\n",
+                     tune_fmpz_mat(state, 1000, 0));
+    fflush(stdout);
+
+    /* multi_mod is used from a dimension proportional to log2(bits) */
+    flint_printf("#define FMPZ_MAT_MUL_MULTI_MOD_CUTOFF %wd\n\n",
+        (tune_fmpz_mat(state, 4*FLINT_BITS, 1) + FLINT_BIT_COUNT(8*FLINT_BITS) - 1)
+                                              / FLINT_BIT_COUNT(8*FLINT_BITS));
+    fflush(stdout);
+
+    /* the array method is used while dense size/(Blen Clen) is below this */
+    flint_printf("#define FMPZ_MPOLY_MUL_ARRAY_CUTOFF %wd\n\n",
+                     tune_fmpz_mpoly(state));
     
     flint_randclear(state);
     
@@ -0,0 +1,144 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef FFT_SMALL_H
+#define FFT_SMALL_H
+
+#ifdef FFT_SMALL_INLINES_C
+#define FFT_SMALL_INLINE FLINT_DLL
+#else
+#define FFT_SMALL_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+    The primes are of the form c*2^FFT_SMALL_MAX_DEPTH + 1 and satisfy
+    4p < 2^FLINT_BITS, so that butterflies can be done lazily with values
+    in [0, 4p). Each prime has at least FFT_SMALL_PRIME_BITS bits.
+*/
+#if FLINT64
+#define FFT_SMALL_NUM_PRIMES 64
+#define FFT_SMALL_PRIME_BITS 61
+#define FFT_SMALL_MAX_DEPTH 40
+#else
+#define FFT_SMALL_NUM_PRIMES 64
+#define FFT_SMALL_PRIME_BITS 28
+#define FFT_SMALL_MAX_DEPTH 20
+#endif
+
+FLINT_DLL extern const mp_limb_t fft_small_primes[FFT_SMALL_NUM_PRIMES];
+FLINT_DLL extern const mp_limb_t fft_small_roots[FFT_SMALL_NUM_PRIMES];
+
+/* Transform context for a fixed prime and transform length ******************/
+
+typedef struct
+{
+    nmod_t mod;
+    flint_bitcnt_t depth;
+    mp_ptr w;       /* w[m + i] = w_{2m}^i for 0 <= i < m, m = 1, 2, ..., n/2 */
+    mp_ptr wpre;
+    mp_ptr iw;      /* inverse twiddles, same layout as w */
+    mp_ptr iwpre;
+    mp_limb_t ninv; /* 1/n mod p */
+    mp_limb_t ninvpre;
+} fft_small_ctx_struct;
+
+typedef fft_small_ctx_struct fft_small_ctx_t[1];
+
+FLINT_DLL void fft_small_ctx_init(fft_small_ctx_t ctx,
+                                     slong prime_index, flint_bitcnt_t depth);
+
+FLINT_DLL void fft_small_ctx_clear(fft_small_ctx_t ctx);
+
+FFT_SMALL_INLINE
+slong fft_small_ctx_length(const fft_small_ctx_t ctx)
+{
+    return WORD(1) << ctx->depth;
+}
+
+/* Lazy Shoup multiplication, returns a value congruent to w*a in [0, 2p) */
+FFT_SMALL_INLINE
+mp_limb_t _fft_small_mulmod_shoup_lazy(mp_limb_t a, mp_limb_t w,
+                                           mp_limb_t wpre, mp_limb_t p)
+{
+    mp_limb_t q, lo;
+
+    umul_ppmm(q, lo, wpre, a);
+
+    return w * a - q * p;
+}
+
+/* Transforms ****************************************************************/
+
+FLINT_DLL void fft_small_fft(mp_ptr x, slong len, const fft_small_ctx_t ctx);
+
+FLINT_DLL void fft_small_ifft(mp_ptr x, const fft_small_ctx_t ctx);
+
+FLINT_DLL void fft_small_mul_pointwise(mp_ptr res, mp_srcptr a, mp_srcptr b,
+                                                    const fft_small_ctx_t ctx);
+
+/* Convolution modulo a single prime *****************************************/
+
+FLINT_DLL flint_bitcnt_t fft_small_depth(slong len);
+
+FLINT_DLL void _fft_small_mullow_prime(mp_ptr res, slong n,
+                       mp_srcptr a, slong alen, mp_srcptr b, slong blen,
+                                                       slong prime_index);
+
+/* CRT to a word-size modulus ************************************************/
+
+typedef struct
+{
+    slong num_primes;
+    nmod_t mod;             /* the target modulus */
+    nmod_t * pmod;          /* the primes */
+    mp_ptr pinv;            /* (p_0 ... p_{i-1})^{-1} mod p_i */
+    mp_ptr pred;            /* pred[i*num_primes + j] = p_j mod p_i */
+    mp_ptr pmod_n;          /* p_j mod n */
+} fft_small_crt_nmod_struct;
+
+typedef fft_small_crt_nmod_struct fft_small_crt_nmod_t[1];
+
+FLINT_DLL void fft_small_crt_nmod_init(fft_small_crt_nmod_t crt,
+                                             slong num_primes, nmod_t mod);
+
+FLINT_DLL void fft_small_crt_nmod_clear(fft_small_crt_nmod_t crt);
+
+FLINT_DLL void _fft_small_crt_nmod(mp_ptr res, mp_srcptr residues,
+                                slong len, const fft_small_crt_nmod_t crt);
+
+FLINT_DLL slong fft_small_nmod_num_primes(slong len1, slong len2, nmod_t mod);
+
+FLINT_DLL void _fft_small_mullow_nmod(mp_ptr res, slong n,
+                       mp_srcptr a, slong alen, mp_srcptr b, slong blen,
+                                                               nmod_t mod);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
@@ -0,0 +1,65 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+/*
+    Garner's algorithm: compute the mixed radix digits t_i with
+    x = t_0 + t_1 p_0 + t_2 p_0 p_1 + ... and evaluate this modulo n.
+    The residues modulo p_i are stored in residues + i*len.
+*/
+void _fft_small_crt_nmod(mp_ptr res, mp_srcptr residues,
+                                  slong len, const fft_small_crt_nmod_t crt)
+{
+    slong i, j, l, k = crt->num_primes;
+    mp_limb_t s, t[FFT_SMALL_NUM_PRIMES];
+    const nmod_t mod = crt->mod;
+
+    if (k == 1)
+    {
+        _nmod_vec_reduce(res, residues, len, mod);
+        return;
+    }
+
+    for (j = 0; j < len; j++)
+    {
+        t[0] = residues[j];
+
+        for (i = 1; i < k; i++)
+        {
+            const nmod_t pm = crt->pmod[i];
+            mp_srcptr pred = crt->pred + i * k;
+
+            NMOD_RED(s, t[i - 1], pm);
+
+            for (l = i - 2; l >= 0; l--)
+            {
+                mp_limb_t u;
+                NMOD_RED(u, t[l], pm);
+                s = nmod_add(nmod_mul(s, pred[l], pm), u, pm);
+            }
+
+            s = nmod_sub(residues[i * len + j], s, pm);
+            t[i] = nmod_mul(s, crt->pinv[i], pm);
+        }
+
+        NMOD_RED(s, t[k - 1], mod);
+
+        for (l = k - 2; l >= 0; l--)
+        {
+            mp_limb_t u;
+            NMOD_RED(u, t[l], mod);
+            s = nmod_add(nmod_mul(s, crt->pmod_n[l], mod), u, mod);
+        }
+
+        res[j] = s;
+    }
+}
@@ -0,0 +1,18 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+void fft_small_crt_nmod_clear(fft_small_crt_nmod_t crt)
+{
+    flint_free(crt->pmod);
+    flint_free(crt->pinv);
+}
@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+void fft_small_crt_nmod_init(fft_small_crt_nmod_t crt,
+                                              slong num_primes, nmod_t mod)
+{
+    slong i, j, k = num_primes;
+    mp_limb_t prod;
+
+    if (num_primes < 1 || num_primes > FFT_SMALL_NUM_PRIMES)
+    {
+        flint_printf("Exception (fft_small_crt_nmod_init). "
+                     "Invalid number of primes.\n");
+        flint_abort();
+    }
+
+    crt->num_primes = k;
+    crt->mod = mod;
+    crt->pmod = (nmod_t *) flint_malloc(k * sizeof(nmod_t));
+    crt->pinv = (mp_ptr) flint_malloc((k * k + 2 * k) * sizeof(mp_limb_t));
+    crt->pred = crt->pinv + k;
+    crt->pmod_n = crt->pred + k * k;
+
+    for (i = 0; i < k; i++)
+        nmod_init(crt->pmod + i, fft_small_primes[i]);
+
+    for (i = 0; i < k; i++)
+    {
+        prod = 1;
+
+        for (j = 0; j < k; j++)
+        {
+            NMOD_RED(crt->pred[i * k + j], fft_small_primes[j], crt->pmod[i]);
+
+            if (j < i)
+                prod = nmod_mul(prod, crt->pred[i * k + j], crt->pmod[i]);
+        }
+
+        crt->pinv[i] = nmod_inv(prod, crt->pmod[i]);
+        NMOD_RED(crt->pmod_n[i], fft_small_primes[i], mod);
+    }
+}
@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+static void
+_fft_small_roots_init(mp_ptr w, mp_ptr wpre, mp_limb_t root,
+                                         flint_bitcnt_t depth, nmod_t mod)
+{
+    slong n = WORD(1) << depth, m, i;
+    mp_limb_t r, pinv;
+
+    if (depth == 0)
+        return;
+
+    /* root is a primitive n-th root of unity, fill the top level first */
+    m = n / 2;
+    w[m] = 1;
+    for (i = 1; i < m; i++)
+        w[m + i] = nmod_mul(w[m + i - 1], root, mod);
+
+    /* w_{2m}^i = w_{4m}^{2i} */
+    for (m = n / 4; m >= 1; m /= 2)
+        for (i = 0; i < m; i++)
+            w[m + i] = w[2*m + 2*i];
+
+    /*
+        wpre[i] = floor(w[i] 2^FLINT_BITS / p) without hardware division:
+        with r = w[i] 2^FLINT_BITS mod p, the quotient times p is -r modulo
+        2^FLINT_BITS, and p is odd
+    */
+    FLINT_ASSERT(mod.n & 1);
+    pinv = mod.n;
+    for (i = 0; i < 5; i++)
+        pinv *= 2 - mod.n*pinv;
+
+    for (i = 1; i < n; i++)
+    {
+        NMOD_RED2(r, w[i], UWORD(0), mod);
+        wpre[i] = -(r*pinv);
+    }
+}
+
+void fft_small_ctx_init(fft_small_ctx_t ctx,
+                                      slong prime_index, flint_bitcnt_t depth)
+{
+    mp_limb_t root;
+    slong n = WORD(1) << depth;
+
+    if (prime_index < 0 || prime_index >= FFT_SMALL_NUM_PRIMES ||
+        depth > FFT_SMALL_MAX_DEPTH)
+    {
+        flint_printf("Exception (fft_small_ctx_init). Invalid prime index "
+                     "or transform depth.\n");
+        flint_abort();
+    }
+
+    nmod_init(&ctx->mod, fft_small_primes[prime_index]);
+    ctx->depth = depth;
+
+    ctx->w = (mp_ptr) flint_malloc(4 * n * sizeof(mp_limb_t));
+    ctx->wpre = ctx->w + n;
+    ctx->iw = ctx->wpre + n;
+    ctx->iwpre = ctx->iw + n;
+
+    /* reduce the primitive 2^FFT_SMALL_MAX_DEPTH-th root to a 2^depth-th */
+    root = nmod_pow_ui(fft_small_roots[prime_index],
+                       UWORD(1) << (FFT_SMALL_MAX_DEPTH - depth), ctx->mod);
+
+    _fft_small_roots_init(ctx->w, ctx->wpre, root, depth, ctx->mod);
+    _fft_small_roots_init(ctx->iw, ctx->iwpre,
+                          nmod_inv(root, ctx->mod), depth, ctx->mod);
+
+    ctx->ninv = nmod_inv(nmod_set_ui(n, ctx->mod), ctx->mod);
+    ctx->ninvpre = n_mulmod_precomp_shoup(ctx->ninv, ctx->mod.n);
+}
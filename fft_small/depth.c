@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+/* smallest depth d with 2^d >= len */
+flint_bitcnt_t fft_small_depth(slong len)
+{
+    flint_bitcnt_t d = 0;
+
+    while ((WORD(1) << d) < len)
+        d++;
+
+    return d;
+}
@@ -0,0 +1,102 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+/*
+    Decimation in frequency with lazy (Harvey) butterflies. Inputs are
+    expected in [0, 2p), outputs are in [0, 2p) in bit reversed order.
+*/
+void fft_small_fft(mp_ptr x, slong len, const fft_small_ctx_t ctx)
+{
+    slong n, m, i, j;
+    mp_limb_t p, p2, a, b, s, t;
+    mp_srcptr w, wpre;
+
+    if (ctx->depth == 0)
+    {
+        if (len == 0)
+            x[0] = 0;
+        return;
+    }
+
+    n = fft_small_ctx_length(ctx);
+    p = ctx->mod.n;
+    p2 = 2 * p;
+    w = ctx->w;
+    wpre = ctx->wpre;
+
+    /* top layer, entries of index >= len are zero */
+    m = n / 2;
+
+    if (len > m)
+    {
+        for (i = 0; i < len - m; i++)
+        {
+            a = x[i];
+            b = x[i + m];
+            s = a + b;
+            s -= (s >= p2) ? p2 : 0;
+            t = a - b + p2;
+            x[i] = s;
+            x[i + m] = _fft_small_mulmod_shoup_lazy(t, w[m + i],
+                                                       wpre[m + i], p);
+        }
+    }
+    else
+        i = 0;
+
+    for ( ; i < FLINT_MIN(len, m); i++)
+        x[i + m] = _fft_small_mulmod_shoup_lazy(x[i], w[m + i],
+                                                       wpre[m + i], p);
+
+    for ( ; i < m; i++)
+    {
+        x[i] = 0;
+        x[i + m] = 0;
+    }
+
+    for (m = n / 4; m >= 2; m /= 2)
+    {
+        for (j = 0; j < n; j += 2*m)
+        {
+            mp_ptr x0 = x + j, x1 = x + j + m;
+
+            for (i = 0; i < m; i++)
+            {
+                a = x0[i];
+                b = x1[i];
+                s = a + b;
+                s -= (s >= p2) ? p2 : 0;
+                t = a - b + p2;
+                x0[i] = s;
+                x1[i] = _fft_small_mulmod_shoup_lazy(t, w[m + i],
+                                                         wpre[m + i], p);
+            }
+        }
+    }
+
+    /* the bottom layer has trivial twiddles */
+    if (n >= 4)
+    {
+        for (j = 0; j < n; j += 2)
+        {
+            a = x[j];
+            b = x[j + 1];
+            s = a + b;
+            s -= (s >= p2) ? p2 : 0;
+            t = a - b + p2;
+            t -= (t >= p2) ? p2 : 0;
+            x[j] = s;
+            x[j + 1] = t;
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+/*
+    Decimation in time with lazy (Harvey) butterflies. Inputs are expected
+    in [0, 2p) in bit reversed order. The output is in natural order, fully
+    reduced and scaled by 1/n, so that ifft(fft(x)) = x.
+*/
+void fft_small_ifft(mp_ptr x, const fft_small_ctx_t ctx)
+{
+    slong n, m, i, j;
+    mp_limb_t p, p2, a, b, t;
+    mp_srcptr w, wpre;
+
+    if (ctx->depth == 0)
+    {
+        x[0] -= (x[0] >= ctx->mod.n) ? ctx->mod.n : 0;
+        return;
+    }
+
+    n = fft_small_ctx_length(ctx);
+    p = ctx->mod.n;
+    p2 = 2 * p;
+    w = ctx->iw;
+    wpre = ctx->iwpre;
+
+    /* the bottom layer has trivial twiddles, outputs are in [0, 4p) */
+    for (j = 0; j < n; j += 2)
+    {
+        a = x[j];
+        b = x[j + 1];
+        x[j] = a + b;
+        x[j + 1] = a - b + p2;
+    }
+
+    for (m = 2; m < n; m *= 2)
+    {
+        for (j = 0; j < n; j += 2*m)
+        {
+            mp_ptr x0 = x + j, x1 = x + j + m;
+
+            for (i = 0; i < m; i++)
+            {
+                a = x0[i];
+                a -= (a >= p2) ? p2 : 0;
+                t = _fft_small_mulmod_shoup_lazy(x1[i], w[m + i],
+                                                        wpre[m + i], p);
+                x0[i] = a + t;
+                x1[i] = a - t + p2;
+            }
+        }
+    }
+
+    /* scale by 1/n and reduce fully */
+    for (i = 0; i < n; i++)
+    {
+        t = _fft_small_mulmod_shoup_lazy(x[i], ctx->ninv, ctx->ninvpre, p);
+        x[i] = t - ((t >= p) ? p : 0);
+    }
+}
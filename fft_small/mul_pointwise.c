@@ -0,0 +1,37 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+void fft_small_mul_pointwise(mp_ptr res, mp_srcptr a, mp_srcptr b,
+                                                     const fft_small_ctx_t ctx)
+{
+    slong i, n = fft_small_ctx_length(ctx);
+    mp_limb_t p = ctx->mod.n, s, t;
+
+    if (a == b)
+    {
+        for (i = 0; i < n; i++)
+        {
+            s = a[i] - ((a[i] >= p) ? p : 0);
+            res[i] = nmod_mul(s, s, ctx->mod);
+        }
+    }
+    else
+    {
+        for (i = 0; i < n; i++)
+        {
+            s = a[i] - ((a[i] >= p) ? p : 0);
+            t = b[i] - ((b[i] >= p) ? p : 0);
+            res[i] = nmod_mul(s, t, ctx->mod);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+void _fft_small_mullow_nmod(mp_ptr res, slong n,
+                       mp_srcptr a, slong alen, mp_srcptr b, slong blen,
+                                                               nmod_t mod)
+{
+    fft_small_crt_nmod_t crt;
+    mp_ptr ap, bp, residues;
+    slong i, len, num_primes;
+    int squaring;
+
+    alen = FLINT_MIN(alen, n);
+    blen = FLINT_MIN(blen, n);
+    squaring = (a == b && alen == blen);
+    len = FLINT_MIN(n, alen + blen - 1);
+
+    if (fft_small_depth(alen + blen - 1) > FFT_SMALL_MAX_DEPTH)
+    {
+        flint_printf("Exception (_fft_small_mullow_nmod). "
+                     "Transform length too large.\n");
+        flint_abort();
+    }
+
+    num_primes = fft_small_nmod_num_primes(alen, blen, mod);
+
+    residues = _nmod_vec_init(num_primes * len + alen + blen);
+    ap = residues + num_primes * len;
+    bp = ap + alen;
+
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_t pmod;
+
+        nmod_init(&pmod, fft_small_primes[i]);
+
+        /* the coefficients only need reducing if n > p */
+        if (mod.n > pmod.n)
+        {
+            _nmod_vec_reduce(ap, a, alen, pmod);
+            if (!squaring)
+                _nmod_vec_reduce(bp, b, blen, pmod);
+
+            _fft_small_mullow_prime(residues + i * len, len, ap, alen,
+                                     squaring ? ap : bp, blen, i);
+        }
+        else
+        {
+            _fft_small_mullow_prime(residues + i * len, len,
+                                                    a, alen, b, blen, i);
+        }
+    }
+
+    fft_small_crt_nmod_init(crt, num_primes, mod);
+    _fft_small_crt_nmod(res, residues, len, crt);
+    fft_small_crt_nmod_clear(crt);
+
+    _nmod_vec_zero(res + len, n - len);
+
+    _nmod_vec_clear(residues);
+}
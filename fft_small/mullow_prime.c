@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+/*
+    Inputs of length > N are folded modulo x^N - 1. Entries are in [0, 2p)
+    afterwards, which is what the transform expects.
+*/
+static void
+_fold(mp_ptr t, mp_srcptr a, slong alen, slong N, mp_limb_t p)
+{
+    slong i;
+
+    if (alen <= N)
+    {
+        _nmod_vec_set(t, a, alen);
+        return;
+    }
+
+    _nmod_vec_set(t, a, N);
+
+    for (i = N; i < alen; i++)
+    {
+        mp_limb_t s = t[i - N] + a[i];
+        t[i - N] = s - ((s >= 2 * p) ? 2 * p : 0);
+    }
+}
+
+/*
+    Cyclic convolution of length N = 2^depth, the result of length N is
+    written to t1, fully reduced.
+*/
+static void
+_fft_small_cyclic(mp_ptr t1, mp_ptr t2, mp_srcptr a, slong alen,
+             mp_srcptr b, slong blen, int squaring, const fft_small_ctx_t ctx)
+{
+    slong N = fft_small_ctx_length(ctx);
+
+    _fold(t1, a, alen, N, ctx->mod.n);
+    fft_small_fft(t1, FLINT_MIN(alen, N), ctx);
+
+    if (!squaring)
+    {
+        _fold(t2, b, blen, N, ctx->mod.n);
+        fft_small_fft(t2, FLINT_MIN(blen, N), ctx);
+    }
+
+    fft_small_mul_pointwise(t1, t1, squaring ? t1 : t2, ctx);
+    fft_small_ifft(t1, ctx);
+}
+
+void _fft_small_mullow_prime(mp_ptr res, slong n,
+                       mp_srcptr a, slong alen, mp_srcptr b, slong blen,
+                                                        slong prime_index)
+{
+    fft_small_ctx_t ctx;
+    flint_bitcnt_t depth;
+    mp_ptr t1, t2, lo;
+    slong i, N, len, m;
+    int squaring;
+
+    alen = FLINT_MIN(alen, n);
+    blen = FLINT_MIN(blen, n);
+    squaring = (a == b && alen == blen);
+    len = alen + blen - 1;
+
+    depth = fft_small_depth(len);
+
+    /*
+        If the product only just exceeds a power of two N, compute it modulo
+        x^N - 1 and recover the wrapped around coefficients from the low
+        m = len - N coefficients, computed recursively. This avoids almost
+        doubling the transform length.
+    */
+    if (depth >= 4 && (len - (WORD(1) << (depth - 1))) <= (WORD(1) << (depth - 3)))
+    {
+        N = WORD(1) << (depth - 1);
+        m = len - N;
+
+        fft_small_ctx_init(ctx, prime_index, depth - 1);
+
+        t1 = _nmod_vec_init((squaring ? N : 2*N) + m);
+        t2 = squaring ? t1 : t1 + N;
+        lo = t1 + (squaring ? N : 2*N);
+
+        _fft_small_cyclic(t1, t2, a, alen, b, blen, squaring, ctx);
+
+        /* low coefficients of the product, squaring is preserved */
+        _fft_small_mullow_prime(lo, m, a, alen, b, blen, prime_index);
+
+        /* t1[i] = c[i] + c[N + i] for i < m */
+        _nmod_vec_set(res, lo, FLINT_MIN(n, m));
+
+        if (n > m)
+            _nmod_vec_set(res + m, t1 + m, FLINT_MIN(n, N) - m);
+
+        for (i = N; i < FLINT_MIN(n, len); i++)
+            res[i] = nmod_sub(t1[i - N], lo[i - N], ctx->mod);
+
+        _nmod_vec_clear(t1);
+    }
+    else
+    {
+        fft_small_ctx_init(ctx, prime_index, depth);
+        N = fft_small_ctx_length(ctx);
+
+        t1 = _nmod_vec_init(squaring ? N : 2*N);
+        t2 = squaring ? t1 : t1 + N;
+
+        _fft_small_cyclic(t1, t2, a, alen, b, blen, squaring, ctx);
+
+        _nmod_vec_set(res, t1, FLINT_MIN(n, len));
+
+        _nmod_vec_clear(t1);
+    }
+
+    if (n > len)
+        _nmod_vec_zero(res + len, n - len);
+
+    fft_small_ctx_clear(ctx);
+}
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+/*
+    Number of primes needed to recover the coefficients of a product of
+    polynomials of the given lengths with coefficients in [0, n), each
+    coefficient being bounded by min(len1, len2) (n - 1)^2.
+*/
+slong fft_small_nmod_num_primes(slong len1, slong len2, nmod_t mod)
+{
+    flint_bitcnt_t bits;
+
+    bits = 2 * FLINT_BIT_COUNT(mod.n - 1) + FLINT_CLOG2(FLINT_MIN(len1, len2));
+
+    return FLINT_MAX(1, (bits + FFT_SMALL_PRIME_BITS - 1) / FFT_SMALL_PRIME_BITS);
+}
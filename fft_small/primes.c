@@ -0,0 +1,296 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "fft_small.h"
+
+/*
+    Largest primes p = c*2^FFT_SMALL_MAX_DEPTH + 1 with 4p < 2^FLINT_BITS,
+    in decreasing order, together with a primitive 2^FFT_SMALL_MAX_DEPTH-th
+    root of unity modulo each of them.
+*/
+
+#if FLINT64
+
+const mp_limb_t fft_small_primes[FFT_SMALL_NUM_PRIMES] =
+{
+    UWORD(4611615649683210241),
+    UWORD(4611613450659954689),
+    UWORD(4611549678985543681),
+    UWORD(4611546380450660353),
+    UWORD(4611524390218104833),
+    UWORD(4611496902427410433),
+    UWORD(4611480409752993793),
+    UWORD(4611468315125088257),
+    UWORD(4611467215613460481),
+    UWORD(4611458419520438273),
+    UWORD(4611454021473927169),
+    UWORD(4611368259566960641),
+    UWORD(4611359463473938433),
+    UWORD(4611355065427427329),
+    UWORD(4611277000101855233),
+    UWORD(4611266004985577473),
+    UWORD(4611253910357671937),
+    UWORD(4611239616706510849),
+    UWORD(4611200034287910913),
+    UWORD(4611170347473960961),
+    UWORD(4611154954311172097),
+    UWORD(4611127466520477697),
+    UWORD(4611115371892572161),
+    UWORD(4611105476287922177),
+    UWORD(4611084585566994433),
+    UWORD(4611041704613511169),
+    UWORD(4610999923171655681),
+    UWORD(4610990027567005697),
+    UWORD(4610988928055377921),
+    UWORD(4610975733915844609),
+    UWORD(4610962539776311297),
+    UWORD(4610953743683289089),
+    UWORD(4610939450032128001),
+    UWORD(4610929554427478017),
+    UWORD(4610874578846089217),
+    UWORD(4610860285194928129),
+    UWORD(4610815205218189313),
+    UWORD(4610775622799589377),
+    UWORD(4610758030613544961),
+    UWORD(4610703055032156161),
+    UWORD(4610695358450761729),
+    UWORD(4610656875543789569),
+    UWORD(4610620591660072961),
+    UWORD(4610606298008911873),
+    UWORD(4610577710706589697),
+    UWORD(4610557919497289729),
+    UWORD(4610541426822873089),
+    UWORD(4610538128287989761),
+    UWORD(4610534829753106433),
+    UWORD(4610528232683339777),
+    UWORD(4610510640497295361),
+    UWORD(4610490849287995393),
+    UWORD(4610472157590323201),
+    UWORD(4610461162474045441),
+    UWORD(4610439172241489921),
+    UWORD(4610414982985678849),
+    UWORD(4610389694218240001),
+    UWORD(4610358907892662273),
+    UWORD(4610342415218245633),
+    UWORD(4610336917660106753),
+    UWORD(4610290738171740161),
+    UWORD(4610274245497323521),
+    UWORD(4610261051357790209),
+    UWORD(4610254454288023553)
+};
+
+const mp_limb_t fft_small_roots[FFT_SMALL_NUM_PRIMES] =
+{
+    UWORD(611971507056309289),
+    UWORD(291604889638457747),
+    UWORD(1291242423054889089),
+    UWORD(3446508872214126660),
+    UWORD(3830756528182632641),
+    UWORD(1505342663865148807),
+    UWORD(569007065792399449),
+    UWORD(3385532597240990828),
+    UWORD(4470784387139953877),
+    UWORD(1213552236768079618),
+    UWORD(3018349931168898587),
+    UWORD(2016035757109329636),
+    UWORD(3892533411014022193),
+    UWORD(1017770944524035280),
+    UWORD(2175103736734624518),
+    UWORD(1724669196643160043),
+    UWORD(1408765792610927327),
+    UWORD(2467104833288224179),
+    UWORD(196380953359173778),
+    UWORD(2329604207381573226),
+    UWORD(1785305984975691767),
+    UWORD(1449814675874786946),
+    UWORD(2583793462838479756),
+    UWORD(2593754884306263226),
+    UWORD(3838880027827528104),
+    UWORD(3155340563066625254),
+    UWORD(4187346084441240682),
+    UWORD(1398638052219022656),
+    UWORD(4266793982816823145),
+    UWORD(3475027521107006946),
+    UWORD(427679778831946404),
+    UWORD(1294370853063724087),
+    UWORD(3764185038105594775),
+    UWORD(4288733642341244528),
+    UWORD(3178900974305834903),
+    UWORD(2894789915906535274),
+    UWORD(2304467189507990120),
+    UWORD(3353832079468572315),
+    UWORD(4055673096854925499),
+    UWORD(2604463944512935175),
+    UWORD(2477001781781501467),
+    UWORD(3565467586912626572),
+    UWORD(615686990309978613),
+    UWORD(1962246418448504464),
+    UWORD(2365308932401214931),
+    UWORD(1738822088441474110),
+    UWORD(4213710185412797075),
+    UWORD(4343345712783739595),
+    UWORD(21402551659298328),
+    UWORD(1963981682196036554),
+    UWORD(624849979581438570),
+    UWORD(757184252064882791),
+    UWORD(145994565792242119),
+    UWORD(4407789007164825058),
+    UWORD(4161472296888820351),
+    UWORD(3918340129081200472),
+    UWORD(212207231098961962),
+    UWORD(2909069023491587238),
+    UWORD(2135874901916265752),
+    UWORD(154254762370106708),
+    UWORD(2359731307427339831),
+    UWORD(3289272014280619299),
+    UWORD(542396190270660261),
+    UWORD(2025964082420433166)
+};
+
+#else
+
+const mp_limb_t fft_small_primes[FFT_SMALL_NUM_PRIMES] =
+{
+    UWORD(1053818881),
+    UWORD(1051721729),
+    UWORD(1045430273),
+    UWORD(1012924417),
+    UWORD(1007681537),
+    UWORD(1004535809),
+    UWORD(998244353),
+    UWORD(985661441),
+    UWORD(976224257),
+    UWORD(975175681),
+    UWORD(972029953),
+    UWORD(962592769),
+    UWORD(957349889),
+    UWORD(950009857),
+    UWORD(943718401),
+    UWORD(940572673),
+    UWORD(938475521),
+    UWORD(935329793),
+    UWORD(925892609),
+    UWORD(924844033),
+    UWORD(919601153),
+    UWORD(918552577),
+    UWORD(913309697),
+    UWORD(907018241),
+    UWORD(899678209),
+    UWORD(897581057),
+    UWORD(883949569),
+    UWORD(880803841),
+    UWORD(862978049),
+    UWORD(850395137),
+    UWORD(833617921),
+    UWORD(824180737),
+    UWORD(818937857),
+    UWORD(802160641),
+    UWORD(800063489),
+    UWORD(799014913),
+    UWORD(786432001),
+    UWORD(770703361),
+    UWORD(754974721),
+    UWORD(745537537),
+    UWORD(740294657),
+    UWORD(718274561),
+    UWORD(715128833),
+    UWORD(710934529),
+    UWORD(683671553),
+    UWORD(666894337),
+    UWORD(655360001),
+    UWORD(648019969),
+    UWORD(645922817),
+    UWORD(639631361),
+    UWORD(635437057),
+    UWORD(605028353),
+    UWORD(597688321),
+    UWORD(595591169),
+    UWORD(581959681),
+    UWORD(576716801),
+    UWORD(531628033),
+    UWORD(493879297),
+    UWORD(469762049),
+    UWORD(468713473),
+    UWORD(463470593),
+    UWORD(459276289),
+    UWORD(447741953),
+    UWORD(415236097)
+};
+
+const mp_limb_t fft_small_roots[FFT_SMALL_NUM_PRIMES] =
+{
+    UWORD(973782742),
+    UWORD(513054490),
+    UWORD(36657000),
+    UWORD(547381916),
+    UWORD(437477051),
+    UWORD(848723745),
+    UWORD(565042129),
+    UWORD(289936572),
+    UWORD(663055806),
+    UWORD(608900796),
+    UWORD(281910293),
+    UWORD(838129283),
+    UWORD(881219545),
+    UWORD(568553086),
+    UWORD(48630206),
+    UWORD(505230317),
+    UWORD(629767060),
+    UWORD(901130559),
+    UWORD(905074945),
+    UWORD(121832176),
+    UWORD(611244703),
+    UWORD(417848856),
+    UWORD(847388864),
+    UWORD(877090376),
+    UWORD(735502894),
+    UWORD(279727937),
+    UWORD(624638753),
+    UWORD(563802334),
+    UWORD(99302199),
+    UWORD(844259121),
+    UWORD(60202040),
+    UWORD(808278610),
+    UWORD(67999243),
+    UWORD(103285015),
+    UWORD(602009724),
+    UWORD(9751976),
+    UWORD(781978211),
+    UWORD(26445905),
+    UWORD(654739677),
+    UWORD(171318557),
+    UWORD(644687374),
+    UWORD(252091508),
+    UWORD(293533613),
+    UWORD(198832771),
+    UWORD(281190517),
+    UWORD(87284159),
+    UWORD(179630168),
+    UWORD(347287805),
+    UWORD(262061944),
+    UWORD(378862849),
+    UWORD(38030138),
+    UWORD(244684262),
+    UWORD(511172575),
+    UWORD(485340273),
+    UWORD(411661659),
+    UWORD(380337905),
+    UWORD(242398695),
+    UWORD(20206669),
+    UWORD(197868229),
+    UWORD(182390608),
+    UWORD(452629859),
+    UWORD(131841646),
+    UWORD(324378451),
+    UWORD(54826948)
+};
+
+#endif
@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "fft_small.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fft_ifft....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        fft_small_ctx_t ctx;
+        flint_bitcnt_t depth = n_randint(state, 12);
+        slong i, n, len, prime_index = n_randint(state, FFT_SMALL_NUM_PRIMES);
+        mp_ptr a, b;
+
+        fft_small_ctx_init(ctx, prime_index, depth);
+        n = fft_small_ctx_length(ctx);
+        len = n_randint(state, n + 1);
+
+        a = _nmod_vec_init(n);
+        b = _nmod_vec_init(n);
+
+        _nmod_vec_randtest(a, state, len, ctx->mod);
+        _nmod_vec_zero(a + len, n - len);
+
+        /* entries beyond len must be ignored */
+        _nmod_vec_set(b, a, len);
+        for (i = len; i < n; i++)
+            b[i] = n_randlimb(state);
+
+        fft_small_fft(b, len, ctx);
+
+        for (i = 0; i < n; i++)
+        {
+            if (b[i] >= 2 * ctx->mod.n)
+            {
+                flint_printf("FAIL (output range):\n");
+                flint_printf("depth = %wu, len = %wd, i = %wd\n", depth, len, i);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fft_small_ifft(b, ctx);
+
+        if (!_nmod_vec_equal(a, b, n))
+        {
+            flint_printf("FAIL (roundtrip):\n");
+            flint_printf("depth = %wu, len = %wd\n", depth, len);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        fft_small_ctx_clear(ctx);
+    }
+
+    /* cyclic convolution against the naive one */
+    for (iter = 0; iter < 200 * flint_test_multiplier(); iter++)
+    {
+        fft_small_ctx_t ctx;
+        flint_bitcnt_t depth = n_randint(state, 8);
+        slong i, j, n, prime_index = n_randint(state, FFT_SMALL_NUM_PRIMES);
+        mp_ptr a, b, c, d;
+
+        fft_small_ctx_init(ctx, prime_index, depth);
+        n = fft_small_ctx_length(ctx);
+
+        a = _nmod_vec_init(n);
+        b = _nmod_vec_init(n);
+        c = _nmod_vec_init(n);
+        d = _nmod_vec_init(n);
+
+        _nmod_vec_randtest(a, state, n, ctx->mod);
+        _nmod_vec_randtest(b, state, n, ctx->mod);
+        _nmod_vec_zero(c, n);
+
+        for (i = 0; i < n; i++)
+            for (j = 0; j < n; j++)
+                c[(i + j) % n] = nmod_add(c[(i + j) % n],
+                                  nmod_mul(a[i], b[j], ctx->mod), ctx->mod);
+
+        _nmod_vec_set(d, b, n);
+        fft_small_fft(a, n, ctx);
+        fft_small_fft(d, n, ctx);
+        fft_small_mul_pointwise(d, a, d, ctx);
+        fft_small_ifft(d, ctx);
+
+        if (!_nmod_vec_equal(c, d, n))
+        {
+            flint_printf("FAIL (convolution):\n");
+            flint_printf("depth = %wu\n", depth);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(c);
+        _nmod_vec_clear(d);
+        fft_small_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
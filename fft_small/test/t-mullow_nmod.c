@@ -0,0 +1,85 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "fft_small.h"
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mullow_nmod....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        nmod_t mod;
+        slong alen, blen, n;
+        mp_ptr a, b, c, d;
+
+        nmod_init(&mod, n_randtest_not_zero(state));
+        alen = 1 + n_randint(state, 200);
+        blen = 1 + n_randint(state, alen);
+        n = 1 + n_randint(state, alen + blen + 10);
+
+        a = _nmod_vec_init(alen);
+        b = _nmod_vec_init(blen);
+        c = _nmod_vec_init(n);
+        d = _nmod_vec_init(alen + blen - 1);
+
+        if (n_randint(state, 2))
+        {
+            _nmod_vec_randtest(a, state, alen, mod);
+            _nmod_vec_randtest(b, state, blen, mod);
+        }
+        else
+        {
+            /* maximal coefficients */
+            slong i;
+            for (i = 0; i < alen; i++)
+                a[i] = mod.n - 1;
+            for (i = 0; i < blen; i++)
+                b[i] = mod.n - 1;
+        }
+
+        _fft_small_mullow_nmod(c, n, a, alen, b, blen, mod);
+        _nmod_poly_mul_classical(d, a, alen, b, blen, mod);
+
+        if (!_nmod_vec_equal(c, d, FLINT_MIN(n, alen + blen - 1)) ||
+            !_nmod_vec_is_zero(c + alen + blen - 1,
+                               FLINT_MAX(0, n - (alen + blen - 1))))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wu, alen = %wd, blen = %wd, trunc = %wd\n",
+                         mod.n, alen, blen, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(c);
+        _nmod_vec_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -282,6 +282,24 @@ void flint_rand_free(flint_rand_s * state)
 #define FLINT_WARN_UNUSED
 #endif
 
+/*
+   Functions defined with FLINT_TARGET_CLONES are compiled for several
+   instruction sets and the best one for the host CPU is picked when the
+   library is loaded. This relies on ifunc support, so it is restricted to
+   GCC on x86-64 with glibc; it can be disabled by defining
+   FLINT_NO_CPU_DISPATCH. The loops are also vectorised when the library is
+   built at -O2, which is what makes the wider instruction sets pay off.
+*/
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) \
+    && __GNUC__ >= 8 && defined(__x86_64__) && defined(__GLIBC__) \
+    && !defined(FLINT_NO_CPU_DISPATCH)
+#define FLINT_TARGET_CLONES \
+    __attribute__((target_clones("arch=skylake-avx512", "avx2", "default"), \
+                   optimize("tree-vectorize")))
+#else
+#define FLINT_TARGET_CLONES
+#endif
+
 #define FLINT_MAX(x, y) ((x) > (y) ? (x) : (y))
 #define FLINT_MIN(x, y) ((x) > (y) ? (y) : (x))
 #define FLINT_ABS(x) ((slong)(x) < 0 ? (-(x)) : (x))
@@ -11,52 +11,157 @@
 
 #include "fmpq_mat.h"
 
-int
-fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
-                                    const fmpz_mat_t Xmod, const fmpz_t mod)
+/*
+    Each entry is multiplied by the product d of the denominators found so
+    far, which makes the remaining denominators small for typical solutions
+    of linear systems. Since d is the lcm of the denominators, the entries
+    are split into consecutive chunks which are first reconstructed in
+    parallel starting from d = 1; the lcm of the denominators of the
+    previous chunks then gives the starting value of d for each chunk, and
+    the chunks are reconstructed again from these. If the values of d do
+    not match up at the ends of the chunks the entries are reconstructed
+    serially, so that the result does not depend on the number of threads.
+*/
+typedef struct
 {
-    fmpz_t num, den, t, u, d;
-    slong i, j;
+    fmpq_mat_struct * X;
+    const fmpz_mat_struct * Xmod;
+    const fmpz * mod;
+    slong len;
+    slong num_chunks;
+    slong first;
+    fmpz * dens;
+    int * success;
+}
+_reconstruct_arg;
 
+/* chunk k + first, starting from d = dens[k + first], which is updated */
+static void
+_reconstruct_worker(slong k, _reconstruct_arg * arg)
+{
+    fmpz_t num, den, t, u;
+    slong i, j, l, start, stop, c = arg->Xmod->c;
+    fmpz * d;
     int success = 1;
 
+    k += arg->first;
+    d = arg->dens + k;
+
     fmpz_init(num);
     fmpz_init(den);
-    fmpz_init(d);
     fmpz_init(t);
     fmpz_init(u);
 
-    fmpz_one(d);
+    start = (k * arg->len) / arg->num_chunks;
+    stop = ((k + 1) * arg->len) / arg->num_chunks;
 
-    for (i = 0; i < Xmod->r; i++)
+    for (l = start; l < stop && success; l++)
     {
-        for (j = 0; j < Xmod->c; j++)
-        {
-            /* TODO: handle various special cases efficiently; zeros,
-                     small integers, etc. */
-            fmpz_mul(t, d, fmpz_mat_entry(Xmod, i, j));
-            fmpz_fdiv_qr(u, t, t, mod);
+        i = l / c;
+        j = l % c;
 
-            success = _fmpq_reconstruct_fmpz(num, den, t, mod);
+        /* TODO: handle various special cases efficiently; zeros,
+                 small integers, etc. */
+        fmpz_mul(t, d, fmpz_mat_entry(arg->Xmod, i, j));
+        fmpz_fdiv_qr(u, t, t, arg->mod);
 
-            if (!success)
-	       goto cleanup;
+        success = _fmpq_reconstruct_fmpz(num, den, t, arg->mod);
 
-	    fmpz_mul(den, den, d);
+        if (success)
+        {
+            fmpz_mul(den, den, d);
             fmpz_set(d, den);
 
-            fmpz_set(fmpq_mat_entry_num(X, i, j), num);
-            fmpz_set(fmpq_mat_entry_den(X, i, j), den);
-            fmpq_canonicalise(fmpq_mat_entry(X, i, j));
+            fmpz_set(fmpq_mat_entry_num(arg->X, i, j), num);
+            fmpz_set(fmpq_mat_entry_den(arg->X, i, j), den);
+            fmpq_canonicalise(fmpq_mat_entry(arg->X, i, j));
         }
     }
 
-cleanup:
+    arg->success[k] = success;
+
     fmpz_clear(num);
     fmpz_clear(den);
-    fmpz_clear(d);
     fmpz_clear(t);
     fmpz_clear(u);
+}
+
+int
+fmpq_mat_set_fmpz_mat_mod_fmpz(fmpq_mat_t X,
+                                    const fmpz_mat_t Xmod, const fmpz_t mod)
+{
+    _reconstruct_arg arg;
+    slong k, num_chunks, len = Xmod->r * Xmod->c;
+    fmpz * seeds;
+    int success = 1;
+
+    if (len == 0)
+        return 1;
+
+    num_chunks = flint_get_num_threads();
+    num_chunks = FLINT_MIN(num_chunks, len * fmpz_size(mod) / 1000 + 1);
+    num_chunks = FLINT_MIN(num_chunks, len);
+
+    arg.X = X;
+    arg.Xmod = Xmod;
+    arg.mod = mod;
+    arg.len = len;
+    arg.num_chunks = num_chunks;
+    arg.first = 0;
+    arg.dens = _fmpz_vec_init(num_chunks);
+    arg.success = flint_malloc(num_chunks * sizeof(int));
+    seeds = _fmpz_vec_init(num_chunks);
+
+    for (k = 0; k < num_chunks; k++)
+        fmpz_one(arg.dens + k);
+
+    flint_parallel_do((do_func_t) _reconstruct_worker, &arg, num_chunks,
+                                                    0, FLINT_PARALLEL_UNIFORM);
+
+    /* the first chunk is reconstructed exactly as in the serial algorithm */
+    if (num_chunks == 1 || !arg.success[0])
+    {
+        success = arg.success[0];
+        goto cleanup;
+    }
+
+    for (k = 1; k < num_chunks; k++)
+        success &= arg.success[k];
+
+    if (success)
+    {
+        /* start each chunk from the lcm of the previous denominators */
+        fmpz_set(seeds + 1, arg.dens + 0);
+        for (k = 2; k < num_chunks; k++)
+            fmpz_lcm(seeds + k, seeds + k - 1, arg.dens + k - 1);
+
+        _fmpz_vec_set(arg.dens + 1, seeds + 1, num_chunks - 1);
+
+        arg.first = 1;
+        flint_parallel_do((do_func_t) _reconstruct_worker, &arg,
+                                num_chunks - 1, 0, FLINT_PARALLEL_UNIFORM);
+
+        for (k = 1; k < num_chunks; k++)
+            success &= arg.success[k];
+
+        for (k = 1; k + 1 < num_chunks && success; k++)
+            success = fmpz_equal(arg.dens + k, seeds + k + 1);
+    }
+
+    if (!success)
+    {
+        arg.num_chunks = 1;
+        arg.first = 0;
+        fmpz_one(arg.dens + 0);
+        _reconstruct_worker(0, &arg);
+        success = arg.success[0];
+    }
+
+cleanup:
+
+    _fmpz_vec_clear(arg.dens, num_chunks);
+    _fmpz_vec_clear(seeds, num_chunks);
+    flint_free(arg.success);
 
     return success;
 }
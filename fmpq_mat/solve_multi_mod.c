@@ -55,6 +55,31 @@ _fmpq_mat_check_solution_fmpz_mat(const fmpq_mat_t X, const fmpz_mat_t A, const
     return ok;
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    const fmpz_mat_struct * B;
+    nmod_mat_struct * Xmod;
+    nmod_mat_struct * Amod;
+    nmod_mat_struct * Bmod;
+    const mp_limb_t * primes;
+    int * ok;
+}
+_solve_worker_arg;
+
+static void
+_solve_worker(slong i, _solve_worker_arg * arg)
+{
+    mp_limb_t p = arg->primes[i];
+
+    _nmod_mat_set_mod(arg->Xmod + i, p);
+    _nmod_mat_set_mod(arg->Amod + i, p);
+    _nmod_mat_set_mod(arg->Bmod + i, p);
+    fmpz_mat_get_nmod_mat(arg->Amod + i, arg->A);
+    fmpz_mat_get_nmod_mat(arg->Bmod + i, arg->B);
+    arg->ok[i] = nmod_mat_solve(arg->Xmod + i, arg->Amod + i, arg->Bmod + i);
+}
+
 void
 _fmpq_mat_solve_multi_mod(fmpq_mat_t X,
                         const fmpz_mat_t A, const fmpz_mat_t B,
@@ -64,8 +89,12 @@ _fmpq_mat_solve_multi_mod(fmpq_mat_t X,
     fmpz_t bound, pprod;
     fmpz_mat_t x;
     fmpq_mat_t AX;
-    slong i, n, nexti, cols;
+    slong i, j, k, n, nexti, cols, batch, num;
     int stabilised; /* has CRT stabilised */
+    mp_limb_t * primes;
+    int * ok;
+    nmod_mat_struct * Xs, * As, * Bs;
+    _solve_worker_arg arg;
 
     n = A->r;
     cols = B->c;
@@ -73,9 +102,6 @@ _fmpq_mat_solve_multi_mod(fmpq_mat_t X,
     fmpz_init(bound);
     fmpz_init(pprod);
 
-    fmpq_mat_init(AX, B->r, B->c);
-    fmpz_mat_init(x, n, cols);
-
     /* Compute bound for the needed modulus. TODO: if one of N and D
        is much smaller than the other, we could use a tighter bound (i.e. 2ND).
        This would require the ability to forward N and D to the
@@ -87,11 +113,48 @@ _fmpq_mat_solve_multi_mod(fmpq_mat_t X,
         fmpz_mul(bound, N, N);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* signs */
 
+    /*
+        The systems modulo a batch of primes, one per thread, are solved in
+        parallel, but there is no point in allocating for more primes than
+        the bound needs. The first slot reuses the matrices passed in.
+    */
+    batch = ((slong) fmpz_bits(bound) - (slong) FLINT_BIT_COUNT(p))
+                                            / (FLINT_BIT_COUNT(p) - 1) + 1;
+    batch = FLINT_MAX(batch, 1);
+    batch = FLINT_MIN(batch, flint_get_num_threads());
+    primes = flint_malloc(batch*sizeof(mp_limb_t));
+    ok = flint_malloc(batch*sizeof(int));
+    Xs = flint_malloc(batch*sizeof(nmod_mat_struct));
+    As = flint_malloc(batch*sizeof(nmod_mat_struct));
+    Bs = flint_malloc(batch*sizeof(nmod_mat_struct));
+
+    Xs[0] = *Xmod;
+    As[0] = *Amod;
+    Bs[0] = *Bmod;
+    for (k = 1; k < batch; k++)
+    {
+        nmod_mat_init(Xs + k, n, cols, 2);
+        nmod_mat_init(As + k, n, n, 2);
+        nmod_mat_init(Bs + k, n, cols, 2);
+    }
+
+    arg.A = A;
+    arg.B = B;
+    arg.Xmod = Xs;
+    arg.Amod = As;
+    arg.Bmod = Bs;
+    arg.primes = primes;
+    arg.ok = ok;
+
+    fmpq_mat_init(AX, B->r, B->c);
+    fmpz_mat_init(x, n, cols);
+
     fmpz_set_ui(pprod, p);
     fmpz_mat_set_nmod_mat(x, Xmod);
 
     i = 1; /* working with i primes */
     nexti = 1; /* when to do next termination test */
+    j = num = 0; /* solutions j, ..., num - 1 of the batch not used yet */
 
     while (fmpz_cmp(pprod, bound) <= 0)
     {
@@ -114,25 +177,54 @@ _fmpq_mat_solve_multi_mod(fmpq_mat_t X,
 
         while (1)
         {
-           p = n_nextprime(p, 1);
-
-           _nmod_mat_set_mod(Xmod, p);
-           _nmod_mat_set_mod(Amod, p);
-           _nmod_mat_set_mod(Bmod, p);
-           fmpz_mat_get_nmod_mat(Amod, A);
-           fmpz_mat_get_nmod_mat(Bmod, B);
-           if (nmod_mat_solve(Xmod, Amod, Bmod))
+           if (j == num)
+           {
+              /* no more primes than the bound still needs */
+              num = (fmpz_bits(bound) - fmpz_bits(pprod))
+                                               / (FLINT_BIT_COUNT(p) - 1) + 1;
+              num = FLINT_MIN(num, batch);
+
+              for (k = 0; k < num; k++)
+              {
+                 p = n_nextprime(p, 1);
+                 primes[k] = p;
+              }
+
+              flint_parallel_do((do_func_t) _solve_worker, &arg, num, 0,
+                                                       FLINT_PARALLEL_UNIFORM);
+              j = 0;
+           }
+
+           if (ok[j])
               break;
+
+           j++;
         }
 
-        fmpz_mat_CRT_ui(x, x, pprod, Xmod, 0); 
-        fmpz_mul_ui(pprod, pprod, p);
+        fmpz_mat_CRT_ui(x, x, pprod, Xs + j, 0);
+        fmpz_mul_ui(pprod, pprod, primes[j]);
+        j++;
     }
 
     fmpq_mat_set_fmpz_mat_mod_fmpz(X, x, pprod);
 
 multi_mod_done:
 
+    *Xmod = Xs[0];
+    *Amod = As[0];
+    *Bmod = Bs[0];
+    for (k = 1; k < batch; k++)
+    {
+        nmod_mat_clear(Xs + k);
+        nmod_mat_clear(As + k);
+        nmod_mat_clear(Bs + k);
+    }
+    flint_free(Xs);
+    flint_free(As);
+    flint_free(Bs);
+    flint_free(primes);
+    flint_free(ok);
+
     fmpz_clear(bound);
     fmpz_clear(pprod);
 
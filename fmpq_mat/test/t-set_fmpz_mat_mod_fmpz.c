@@ -0,0 +1,123 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "flint.h"
+#include "fmpq.h"
+#include "fmpq_mat.h"
+
+int
+main(void)
+{
+    slong iter;
+    slong max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_fmpz_mat_mod_fmpz....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 50 * flint_test_multiplier(); iter++)
+    {
+        fmpq_mat_t X, Y, Z;
+        fmpz_mat_t Xmod;
+        fmpz_t mod, D;
+        slong i, j, r, c, bits, nbits, dbits;
+        int success1, success2;
+
+        r = n_randint(state, 15);
+        c = n_randint(state, 15);
+        bits = 2 + n_randint(state, 1500);
+        nbits = 1 + n_randint(state, bits/2 + 10);
+        dbits = 1 + n_randint(state, bits/2 + 10);
+
+        fmpq_mat_init(X, r, c);
+        fmpq_mat_init(Y, r, c);
+        fmpq_mat_init(Z, r, c);
+        fmpz_mat_init(Xmod, r, c);
+        fmpz_init(mod);
+        fmpz_init(D);
+
+        fmpz_randbits(mod, state, bits);
+        fmpz_abs(mod, mod);
+        fmpz_nextprime(mod, mod, 0);
+
+        /* entries with denominators dividing a common denominator */
+        do {
+            fmpz_randtest_not_zero(D, state, dbits);
+            fmpz_abs(D, D);
+        } while (fmpz_divisible(D, mod));
+
+        for (i = 0; i < r; i++)
+        {
+            for (j = 0; j < c; j++)
+            {
+                fmpq * x = fmpq_mat_entry(X, i, j);
+
+                fmpz_randtest(fmpq_numref(x), state, nbits);
+                fmpz_gcd(fmpq_denref(x), D, fmpq_numref(x));
+                fmpz_divexact(fmpq_denref(x), D, fmpq_denref(x));
+                fmpq_canonicalise(x);
+                fmpq_mod_fmpz(fmpz_mat_entry(Xmod, i, j), x, mod);
+            }
+        }
+
+        flint_set_num_threads(1);
+        success1 = fmpq_mat_set_fmpz_mat_mod_fmpz(Y, Xmod, mod);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+        success2 = fmpq_mat_set_fmpz_mat_mod_fmpz(Z, Xmod, mod);
+
+        if (success1 != success2 || (success1 && !fmpq_mat_equal(Y, Z)))
+        {
+            flint_printf("FAIL (threads)\n");
+            flint_printf("success1 = %d, success2 = %d\n", success1, success2);
+            flint_printf("X:\n"); fmpq_mat_print(X);
+            flint_printf("mod: "); fmpz_print(mod); flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        if (success1)
+        {
+            /* the reconstruction must reproduce the residues */
+            for (i = 0; i < r; i++)
+            {
+                for (j = 0; j < c; j++)
+                {
+                    fmpz_t t;
+                    fmpz_init(t);
+                    fmpq_mod_fmpz(t, fmpq_mat_entry(Y, i, j), mod);
+
+                    if (!fmpz_equal(t, fmpz_mat_entry(Xmod, i, j)))
+                    {
+                        flint_printf("FAIL (residue)\n");
+                        fflush(stdout);
+                        flint_abort();
+                    }
+
+                    fmpz_clear(t);
+                }
+            }
+        }
+
+        fmpq_mat_clear(X);
+        fmpq_mat_clear(Y);
+        fmpq_mat_clear(Z);
+        fmpz_mat_clear(Xmod);
+        fmpz_clear(mod);
+        fmpz_clear(D);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -21,6 +21,7 @@ int
 main(void)
 {
     int i;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
     
 
@@ -40,6 +41,8 @@ main(void)
         m = n_randint(state, 40);
         bits = 1 + n_randint(state, 100);
 
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         fmpz_mat_init(A, n, n);
         fmpz_mat_init(B, n, m);
         fmpz_mat_init(AX_Z, n, m);
@@ -56,6 +56,23 @@ typedef struct
 
 typedef fmpz_preinvn_struct fmpz_preinvn_t[1];
 
+typedef struct
+{
+   fmpz_t b;
+   mp_limb_t ** jj; /* transform of b, used by fft_convolution_precache */
+   mp_size_t n1;
+   slong depth;
+   slong w;
+   flint_bitcnt_t bits;
+   slong limbs;
+   slong trunc;
+} fmpz_mul_precache_struct;
+
+typedef fmpz_mul_precache_struct fmpz_mul_precache_t[1];
+
+/* operands with fewer limbs are multiplied with fmpz_mul */
+#define FMPZ_MUL_PRECACHE_CUTOFF 2000
+
 typedef struct
 {
    int count;
@@ -498,6 +515,14 @@ FLINT_DLL void fmpz_mul_si(fmpz_t f, const fmpz_t g, slong x);
 
 FLINT_DLL void fmpz_mul(fmpz_t f, const fmpz_t g, const fmpz_t h);
 
+FLINT_DLL void fmpz_mul_precache_init(fmpz_mul_precache_t pre,
+                                     const fmpz_t b, flint_bitcnt_t bits1);
+
+FLINT_DLL void fmpz_mul_precache_clear(fmpz_mul_precache_t pre);
+
+FLINT_DLL void fmpz_mul_precache(fmpz_t f, const fmpz_t g,
+                                              const fmpz_mul_precache_t pre);
+
 FLINT_DLL void fmpz_mul_2exp(fmpz_t f, const fmpz_t g, ulong exp);
 
 FLINT_DLL void fmpz_one_2exp(fmpz_t f, ulong exp);
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -9,11 +10,236 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
 
+#if FLINT_USES_TLS && FLINT_USES_PTHREAD && \
+    (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8))
+#define FMPZ_USE_ARENA 1
+#else
+#define FMPZ_USE_ARENA 0
+#endif
+
+#if FMPZ_USE_ARENA
+
+/*
+    Each thread allocates its mpz's from its own arena, in chunks of
+    MPZ_BLOCK at a time, and keeps the freed ones on a private free list.
+    An mpz freed by a thread other than its owner is pushed onto the owner's
+    remote free stack with a compare-and-swap; the owner takes the whole
+    stack at once when its private list runs dry, so no locks are taken on
+    either path.
+
+    When the owner calls flint_cleanup, the remote stack is replaced by the
+    marker ARENA_ORPHANED. The mpz's still in use elsewhere are then cleared
+    as they are freed, and whoever frees the last one releases the arena.
+*/
+
+/* Always free larger mpz's to avoid wasting too much heap space */
+#define FLINT_MPZ_MAX_CACHE_LIMBS 64
+
+/* The number of new mpz's allocated at a time */
+#define MPZ_BLOCK 64
+
+typedef struct fmpz_arena_struct fmpz_arena_struct;
+
+typedef struct fmpz_slot_struct
+{
+    fmpz_arena_struct * arena;
+    struct fmpz_slot_struct * next;
+    __mpz_struct z;
+} fmpz_slot_struct;
+
+typedef struct fmpz_chunk_struct
+{
+    struct fmpz_chunk_struct * next;
+    fmpz_slot_struct slots[MPZ_BLOCK];
+} fmpz_chunk_struct;
+
+struct fmpz_arena_struct
+{
+    fmpz_slot_struct * free;        /* private free list */
+    fmpz_chunk_struct * chunks;
+    slong live;                     /* slots handed out, owner view */
+    fmpz_slot_struct * remote;      /* remote free stack */
+    slong orphans;                  /* outstanding slots once orphaned */
+};
+
+#define ARENA_ORPHANED ((fmpz_slot_struct *) 1)
+
+#define SLOT_FROM_MPZ(ptr) \
+    ((fmpz_slot_struct *) ((char *) (ptr) - offsetof(fmpz_slot_struct, z)))
+
+static FLINT_TLS_PREFIX fmpz_arena_struct * fmpz_arena = NULL;
+
+static void
+_fmpz_arena_free(fmpz_arena_struct * arena)
+{
+    fmpz_chunk_struct * c, * next;
+
+    for (c = arena->chunks; c != NULL; c = next)
+    {
+        next = c->next;
+        flint_free(c);
+    }
+
+    flint_free(arena);
+}
+
+/* called once the owner has released its claim on the arena */
+static void
+_fmpz_arena_orphan_release(fmpz_arena_struct * arena, slong n)
+{
+    if (__atomic_add_fetch(&arena->orphans, n, __ATOMIC_ACQ_REL) == 0)
+        _fmpz_arena_free(arena);
+}
+
+__mpz_struct * _fmpz_new_mpz(void)
+{
+    fmpz_arena_struct * arena = fmpz_arena;
+    fmpz_slot_struct * s;
+
+    if (arena == NULL)
+    {
+        arena = (fmpz_arena_struct *) flint_malloc(sizeof(fmpz_arena_struct));
+        arena->free = NULL;
+        arena->chunks = NULL;
+        arena->live = 0;
+        arena->remote = NULL;
+        arena->orphans = 0;
+        fmpz_arena = arena;
+    }
+
+    if (arena->free == NULL)
+    {
+        /* reclaim everything freed by other threads */
+        arena->free = __atomic_exchange_n(&arena->remote, NULL,
+                                                            __ATOMIC_ACQUIRE);
+
+        for (s = arena->free; s != NULL; s = s->next)
+            arena->live--;
+    }
+
+    if (arena->free == NULL)
+    {
+        fmpz_chunk_struct * c;
+        slong i;
+
+        c = (fmpz_chunk_struct *) flint_malloc(sizeof(fmpz_chunk_struct));
+        c->next = arena->chunks;
+        arena->chunks = c;
+
+        for (i = 0; i < MPZ_BLOCK; i++)
+        {
+            c->slots[i].arena = arena;
+            c->slots[i].next = (i + 1 < MPZ_BLOCK) ? c->slots + i + 1 : NULL;
+            mpz_init2(&c->slots[i].z, 2*FLINT_BITS);
+        }
+
+        arena->free = c->slots;
+    }
+
+    s = arena->free;
+    arena->free = s->next;
+    arena->live++;
+
+    return &s->z;
+}
+
+void _fmpz_clear_mpz(fmpz f)
+{
+    __mpz_struct * ptr = COEFF_TO_PTR(f);
+    fmpz_slot_struct * s = SLOT_FROM_MPZ(ptr);
+    fmpz_arena_struct * arena = s->arena;
+    fmpz_slot_struct * head;
+
+    if (arena == NULL)
+    {
+        mpz_clear(ptr);
+        flint_free(s);
+        return;
+    }
+
+    if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS)
+        mpz_realloc2(ptr, 2*FLINT_BITS);
+
+    if (arena == fmpz_arena)
+    {
+        s->next = arena->free;
+        arena->free = s;
+        arena->live--;
+        return;
+    }
+
+    head = __atomic_load_n(&arena->remote, __ATOMIC_RELAXED);
+
+    do {
+        if (head == ARENA_ORPHANED)
+        {
+            mpz_clear(ptr);
+            _fmpz_arena_orphan_release(arena, -1);
+            return;
+        }
+
+        s->next = head;
+    } while (!__atomic_compare_exchange_n(&arena->remote, &head, s, 1,
+                                       __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+/*
+    The struct of a readonly fmpz is not taken from the arena, so that it
+    is not counted against the arena of the thread that created it.
+*/
+void _fmpz_init_readonly_mpz(fmpz_t f, const mpz_t z)
+{
+    fmpz_slot_struct * s;
+
+    s = (fmpz_slot_struct *) flint_malloc(sizeof(fmpz_slot_struct));
+    s->arena = NULL;
+    s->next = NULL;
+    s->z = *z;
+    *f = PTR_TO_COEFF(&s->z);
+}
+
+void _fmpz_cleanup_mpz_content(void)
+{
+    fmpz_arena_struct * arena = fmpz_arena;
+    fmpz_slot_struct * s, * remote;
+    slong outstanding;
+
+    if (arena == NULL)
+        return;
+
+    fmpz_arena = NULL;
+
+    /* slots freed by other threads from now on are cleared by them */
+    remote = __atomic_exchange_n(&arena->remote, ARENA_ORPHANED,
+                                                            __ATOMIC_ACQ_REL);
+
+    outstanding = arena->live;
+
+    for (s = remote; s != NULL; s = s->next)
+    {
+        mpz_clear(&s->z);
+        outstanding--;
+    }
+
+    for (s = arena->free; s != NULL; s = s->next)
+        mpz_clear(&s->z);
+
+    _fmpz_arena_orphan_release(arena, outstanding);
+}
+
+void _fmpz_cleanup(void)
+{
+    _fmpz_cleanup_mpz_content();
+}
+
+#else
+
 __mpz_struct * _fmpz_new_mpz(void)
 {
     __mpz_struct * mf = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
@@ -24,7 +250,14 @@ __mpz_struct * _fmpz_new_mpz(void)
 void _fmpz_clear_mpz(fmpz f)
 {
     mpz_clear(COEFF_TO_PTR(f));
-    flint_free(COEFF_TO_PTR(f));  
+    flint_free(COEFF_TO_PTR(f));
+}
+
+void _fmpz_init_readonly_mpz(fmpz_t f, const mpz_t z)
+{
+    __mpz_struct * mf = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
+    *f = PTR_TO_COEFF(mf);
+    *mf = *z;
 }
 
 void _fmpz_cleanup_mpz_content(void)
@@ -35,6 +268,8 @@ void _fmpz_cleanup(void)
 {
 }
 
+#endif
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f))  /* f is small so promote it first */
@@ -85,13 +320,6 @@ void _fmpz_demote_val(fmpz_t f)
     /* don't do anything if value has to be multi precision */
 }
 
-void _fmpz_init_readonly_mpz(fmpz_t f, const mpz_t z)
-{
-   __mpz_struct * mf = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
-    *f = PTR_TO_COEFF(mf);
-    *mf = *z;
-}
-
 void _fmpz_clear_readonly_mpz(mpz_t z)
 {
     if (((z->_mp_size == 1 || z->_mp_size == -1) && (z->_mp_d[0] <= COEFF_MAX))
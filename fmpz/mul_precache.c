@@ -0,0 +1,184 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fmpz.h"
+#include "fft.h"
+#include "fft_tuning.h"
+
+static int fft_tuning_table[5][2] = FFT_TAB;
+
+/*
+    Choose the FFT length 2^depth and coefficient size w in the same way as
+    flint_mpn_mul_fft_main does for a product of an n1 and an n2 limb
+    integer.
+*/
+static void
+_fmpz_mul_precache_params(slong * depth_out, slong * w_out,
+                                                   mp_size_t n1, mp_size_t n2)
+{
+    slong depth = 6, w = 1, off;
+    mp_size_t n = WORD(1) << depth;
+    flint_bitcnt_t bits = (n*w - (depth + 1))/2;
+    flint_bitcnt_t bits1 = n1*FLINT_BITS;
+    flint_bitcnt_t bits2 = n2*FLINT_BITS;
+    mp_size_t j1 = (bits1 - 1)/bits + 1;
+    mp_size_t j2 = (bits2 - 1)/bits + 1;
+
+    while (j1 + j2 - 1 > 4*n)
+    {
+        if (w == 1)
+            w = 2;
+        else
+        {
+            depth++;
+            w = 1;
+            n *= 2;
+        }
+
+        bits = (n*w - (depth + 1))/2;
+        j1 = (bits1 - 1)/bits + 1;
+        j2 = (bits2 - 1)/bits + 1;
+    }
+
+    if (depth < 11)
+    {
+        mp_size_t wadj = 1;
+
+        off = fft_tuning_table[depth - 6][w - 1];
+        depth -= off;
+        n = WORD(1) << depth;
+        w *= WORD(1) << (2*off);
+
+        if (depth < 6)
+            wadj = WORD(1) << (6 - depth);
+
+        if (w > wadj)
+        {
+            do {
+                w -= wadj;
+                bits = (n*w - (depth + 1))/2;
+                j1 = (bits1 - 1)/bits + 1;
+                j2 = (bits2 - 1)/bits + 1;
+            } while (j1 + j2 - 1 <= 4*n && w > wadj);
+            w += wadj;
+        }
+    }
+    else if (j1 + j2 - 1 <= 3*n)
+    {
+        depth--;
+        w *= 3;
+    }
+
+    *depth_out = depth;
+    *w_out = w;
+}
+
+void fmpz_mul_precache_init(fmpz_mul_precache_t pre, const fmpz_t b,
+                                                          flint_bitcnt_t bits1)
+{
+    mp_size_t n1, n2, n, size, i, j2;
+    mp_limb_t * ptr, * t1, * t2, * s1;
+    __mpz_struct * mb;
+
+    fmpz_init_set(pre->b, b);
+    pre->jj = NULL;
+
+    n1 = (bits1 + FLINT_BITS - 1)/FLINT_BITS;
+    n2 = fmpz_size(b);
+    pre->n1 = n1;
+
+    if (FLINT_MIN(n1, n2) < FMPZ_MUL_PRECACHE_CUTOFF)
+        return;
+
+    _fmpz_mul_precache_params(&pre->depth, &pre->w, n1, n2);
+
+    n = WORD(1) << pre->depth;
+    pre->bits = (n*pre->w - (pre->depth + 1))/2;
+    pre->limbs = (n*pre->w)/FLINT_BITS;
+    size = pre->limbs + 1;
+
+    pre->trunc = (n1*FLINT_BITS - 1)/pre->bits + (n2*FLINT_BITS - 1)/pre->bits + 1;
+    pre->trunc = FLINT_MAX(pre->trunc, 2*n + 1);
+
+    pre->jj = (mp_limb_t **) flint_malloc((4*(n + n*size) + 3*size)*sizeof(mp_limb_t));
+    for (i = 0, ptr = (mp_limb_t *) pre->jj + 4*n; i < 4*n; i++, ptr += size)
+        pre->jj[i] = ptr;
+    t1 = ptr;
+    t2 = t1 + size;
+    s1 = t2 + size;
+
+    mb = COEFF_TO_PTR(*pre->b);
+    j2 = fft_split_bits(pre->jj, mb->_mp_d, n2, pre->bits, pre->limbs);
+    for (i = j2; i < 4*n; i++)
+        flint_mpn_zero(pre->jj[i], size);
+
+    fft_precache(pre->jj, pre->depth, pre->limbs, pre->trunc, &t1, &t2, &s1);
+}
+
+void fmpz_mul_precache_clear(fmpz_mul_precache_t pre)
+{
+    flint_free(pre->jj);
+    fmpz_clear(pre->b);
+}
+
+void fmpz_mul_precache(fmpz_t f, const fmpz_t g, const fmpz_mul_precache_t pre)
+{
+    mp_size_t n1, n2, n, rn, size, i, j1, j2;
+    mp_limb_t ** ii, * ptr, * t1, * t2, * s1, * tt, * d;
+    __mpz_struct * mg, * mf;
+    int neg;
+
+    n1 = fmpz_size(g);
+
+    if (pre->jj == NULL || n1 < FMPZ_MUL_PRECACHE_CUTOFF || n1 > pre->n1)
+    {
+        fmpz_mul(f, g, pre->b);
+        return;
+    }
+
+    mg = COEFF_TO_PTR(*g);
+    n2 = fmpz_size(pre->b);
+    neg = (mg->_mp_size < 0) ^ (fmpz_sgn(pre->b) < 0);
+
+    n = WORD(1) << pre->depth;
+    size = pre->limbs + 1;
+
+    ii = (mp_limb_t **) flint_malloc((4*(n + n*size) + 5*size)*sizeof(mp_limb_t));
+    for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size)
+        ii[i] = ptr;
+    t1 = ptr;
+    t2 = t1 + size;
+    s1 = t2 + size;
+    tt = s1 + size;
+
+    j1 = fft_split_bits(ii, mg->_mp_d, n1, pre->bits, pre->limbs);
+    for (i = j1; i < 4*n; i++)
+        flint_mpn_zero(ii[i], size);
+    j2 = (n2*FLINT_BITS - 1)/pre->bits + 1;
+
+    /* pre->jj is only read */
+    fft_convolution_precache(ii, pre->jj, pre->depth, pre->limbs, pre->trunc,
+                                                        &t1, &t2, &s1, &tt);
+
+    rn = n1 + n2;
+    mf = _fmpz_promote(f);
+    d = FLINT_MPZ_REALLOC(mf, rn);
+    flint_mpn_zero(d, rn);
+    fft_combine_bits(d, ii, j1 + j2 - 1, pre->bits, pre->limbs, rn);
+    MPN_NORM(d, rn);
+    mf->_mp_size = neg ? -rn : rn;
+
+    flint_free(ii);
+}
@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "thread_pool.h"
+#include "thread_support.h"
+
+/* mpz's allocated in one thread and freed in another */
+
+typedef struct
+{
+    fmpz * vec;
+    slong len;
+    flint_bitcnt_t bits;
+}
+work_struct;
+
+void
+worker_set(slong i, void * varg)
+{
+    work_struct * arg = (work_struct *) varg;
+
+    fmpz_one(arg->vec + i);
+    fmpz_mul_2exp(arg->vec + i, arg->vec + i, arg->bits + i);
+    fmpz_add_ui(arg->vec + i, arg->vec + i, i);
+}
+
+void
+worker_clear(slong i, void * varg)
+{
+    work_struct * arg = (work_struct *) varg;
+
+    fmpz_zero(arg->vec + i);
+}
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("fmpz_cross_thread....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 100 * flint_test_multiplier(); iter++)
+    {
+        work_struct arg;
+        fmpz_t t;
+        slong i;
+
+        arg.len = n_randint(state, 300);
+        arg.bits = FLINT_BITS + n_randint(state, 200);
+        arg.vec = _fmpz_vec_init(arg.len);
+        fmpz_init(t);
+
+        flint_set_num_threads(n_randint(state, 6) + 1);
+
+        /* allocate in the workers */
+        flint_parallel_do(worker_set, &arg, arg.len, 0, FLINT_PARALLEL_STRIDED);
+
+        for (i = 0; i < arg.len; i++)
+        {
+            fmpz_one(t);
+            fmpz_mul_2exp(t, t, arg.bits + i);
+            fmpz_add_ui(t, t, i);
+
+            if (!fmpz_equal(t, arg.vec + i))
+            {
+                flint_printf("FAIL (set)\n");
+                flint_printf("i = %wd\n", i);
+                flint_abort();
+            }
+        }
+
+        /* free some here and let the workers free the rest */
+        for (i = 0; i < arg.len; i += 2)
+            fmpz_zero(arg.vec + i);
+
+        for (i = 0; i < arg.len; i += 3)
+            fmpz_set(arg.vec + i, t);
+
+        flint_parallel_do(worker_clear, &arg, arg.len, 0, FLINT_PARALLEL_UNIFORM);
+
+        /* values still alive when the workers exit */
+        flint_parallel_do(worker_set, &arg, arg.len, 0, FLINT_PARALLEL_STRIDED);
+        flint_set_num_threads(1);
+
+        for (i = 0; i < arg.len; i++)
+            fmpz_add_ui(arg.vec + i, arg.vec + i, 1);
+
+        _fmpz_vec_clear(arg.vec, arg.len);
+        fmpz_clear(t);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
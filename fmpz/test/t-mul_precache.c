@@ -0,0 +1,102 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_precache....");
+    fflush(stdout);
+
+    for (i = 0; i < 30 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c, d;
+        fmpz_mul_precache_t pre;
+        flint_bitcnt_t bits1, bits2;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+        fmpz_init(d);
+
+        /* mostly large enough for the transform to be used */
+        bits1 = n_randint(state, 3*FMPZ_MUL_PRECACHE_CUTOFF*FLINT_BITS) + 1;
+        bits2 = n_randint(state, 3*FMPZ_MUL_PRECACHE_CUTOFF*FLINT_BITS) + 1;
+        if (n_randint(state, 4) != 0)
+        {
+            bits1 += FMPZ_MUL_PRECACHE_CUTOFF*FLINT_BITS;
+            bits2 += FMPZ_MUL_PRECACHE_CUTOFF*FLINT_BITS;
+        }
+
+        fmpz_randbits(b, state, bits2);
+        fmpz_mul_precache_init(pre, b, bits1);
+
+        /* the same precomputation is used several times */
+        for (j = 0; j < 4; j++)
+        {
+            /* a may also be smaller or larger than bits1 */
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    fmpz_randtest(a, state, bits1);
+                    break;
+                case 1:
+                    fmpz_randbits(a, state, 2*bits1);
+                    break;
+                default:
+                    fmpz_randbits(a, state, bits1);
+            }
+
+            fmpz_mul(c, a, b);
+
+            if (n_randint(state, 2))
+            {
+                fmpz_mul_precache(d, a, pre);
+            }
+            else
+            {
+                fmpz_set(d, a);
+                fmpz_mul_precache(d, d, pre);
+            }
+
+            result = fmpz_equal(c, d);
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("bits1 = %wu, bits2 = %wu\n", bits1, bits2);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        fmpz_mul_precache_clear(pre);
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+        fmpz_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
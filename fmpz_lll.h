@@ -41,6 +41,9 @@
 
 #define SIZE_RED_FAILURE_THRESH 5
 
+/* number of entry operations from which the L^2 steps use threads */
+#define FMPZ_LLL_PARALLEL_CUTOFF 4096
+
 typedef enum
 {
     GRAM,
@@ -59,6 +62,7 @@ typedef struct
     double eta;
     rep_type rt;
     gram_type gt;
+    int thread_limit;
 } fmpz_lll_struct;
 
 typedef fmpz_lll_struct fmpz_lll_t[1];
@@ -98,6 +102,10 @@ FLINT_DLL int fmpz_lll_check_babai_heuristic_d(int kappa, fmpz_mat_t B, fmpz_mat
 
 FLINT_DLL int fmpz_lll_shift(const fmpz_mat_t B);
 
+FLINT_DLL void _fmpz_lll_size_reduce(fmpz_mat_t B, fmpz_mat_t U, int kappa,
+       const int * rows, const slong * xx, const int * expo,
+       slong len, int n, const fmpz_lll_t fl);
+
 FLINT_DLL int fmpz_lll_d(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
 
 FLINT_DLL int fmpz_lll_d_heuristic(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
@@ -19,6 +19,40 @@
 #endif
 #define GM ((fl->rt == Z_BASIS) ? A->exactSP : B)
 
+/*
+    The Gram entries of row kappa that are not known are independent of each
+    other; for long rows they are computed in parallel up front.
+*/
+typedef struct
+{
+    fmpz_mat_struct * B;
+    d_mat_struct * appB;
+    int * expo;
+    fmpz_gram_union * A;
+    int kappa;
+    int start;
+    int n;
+}
+_babai_gram_arg;
+
+static void
+_babai_gram_worker(slong i, _babai_gram_arg * arg)
+{
+    fmpz_mat_struct * B = arg->B;
+    d_mat_struct * appB = arg->appB;
+    int * expo = arg->expo;
+    fmpz_gram_union * A = arg->A;
+    int j = arg->start + i;
+
+    (void) B;       /* not used by every COMPUTE */
+    (void) expo;
+
+    if (d_is_nan(d_mat_entry(A->appSP, arg->kappa, j)))
+    {
+        COMPUTE(A->appSP, arg->kappa, j, arg->n);
+    }
+}
+
 FUNC_HEAD
 {
     if (fl->rt == Z_BASIS && fl->gt == APPROX)
@@ -28,16 +62,43 @@ FUNC_HEAD
         double tmp, rtmp, halfplus, onedothalfplus;
         ulong loops;
 
+        int * red_rows, * red_expo;
+        slong * red_xx, red_len;
+
         aa = (a > zeros) ? a : zeros + 1;
 
         halfplus = (fl->eta + 0.5) / 2;
         onedothalfplus = 1.0 + halfplus;
 
+        red_rows = (int *) flint_malloc(FLINT_MAX(LIMIT, 1) * sizeof(int));
+        red_expo = (int *) flint_malloc(FLINT_MAX(LIMIT, 1) * sizeof(int));
+        red_xx = (slong *) flint_malloc(FLINT_MAX(LIMIT, 1) * sizeof(slong));
+
         loops = 0;
 
         do
         {
             test = 0;
+            red_len = 0;
+
+            /* dot products of doubles are cheap, only thread larger rows */
+            if (LIMIT - aa > 1 && fl->thread_limit != 1 &&
+                (slong) (LIMIT - aa) * n >= 8 * FMPZ_LLL_PARALLEL_CUTOFF &&
+                flint_get_num_threads() > 1)
+            {
+                _babai_gram_arg garg;
+
+                garg.B = B;
+                garg.appB = appB;
+                garg.expo = expo;
+                garg.A = A;
+                garg.kappa = kappa;
+                garg.start = aa;
+                garg.n = n;
+
+                flint_parallel_do((do_func_t) _babai_gram_worker, &garg,
+                             LIMIT - aa, fl->thread_limit, FLINT_PARALLEL_UNIFORM);
+            }
 
             /* ************************************** */
             /* Step2: compute the GSO for stage kappa */
@@ -97,6 +158,9 @@ FUNC_HEAD
                 }
                 if (new_max_expo > max_expo - SIZE_RED_FAILURE_THRESH)
                 {
+                    flint_free(red_rows);
+                    flint_free(red_expo);
+                    flint_free(red_xx);
                     return -1;
                 }
                 max_expo = new_max_expo;
@@ -128,14 +192,9 @@ FUNC_HEAD
                                 d_mat_entry(mu, kappa, k) =
                                     d_mat_entry(mu, kappa, k) - tmp;
                             }
-                            _fmpz_vec_sub(B->rows[kappa], B->rows[kappa],
-                                          B->rows[j], n);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_sub(U->rows[kappa],
-                                              U->rows[kappa], U->rows[j],
-                                              U->c);
-                            }
+                            red_rows[red_len] = j;
+                            red_xx[red_len] = 1;
+                            red_expo[red_len++] = 0;
                         }
                         else    /* otherwise X is -1 */
                         {
@@ -145,14 +204,9 @@ FUNC_HEAD
                                 d_mat_entry(mu, kappa, k) =
                                     d_mat_entry(mu, kappa, k) + tmp;
                             }
-                            _fmpz_vec_add(B->rows[kappa], B->rows[kappa],
-                                          B->rows[j], n);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_add(U->rows[kappa],
-                                              U->rows[kappa], U->rows[j],
-                                              U->c);
-                            }
+                            red_rows[red_len] = j;
+                            red_xx[red_len] = -1;
+                            red_expo[red_len++] = 0;
                         }
                     }
                     else        /* we must have |X| >= 2 */
@@ -175,14 +229,9 @@ FUNC_HEAD
                             }
 
                             xx = (slong) tmp;
-                            _fmpz_vec_scalar_submul_si(B->rows[kappa],
-                                                       B->rows[j], n, xx);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_scalar_submul_si(U->rows[kappa],
-                                                           U->rows[j],
-                                                           U->c, xx);
-                            }
+                            red_rows[red_len] = j;
+                            red_xx[red_len] = xx;
+                            red_expo[red_len++] = 0;
                         }
                         else
                         {
@@ -200,15 +249,9 @@ FUNC_HEAD
                                 xx = xx << -exponent;
                                 exponent = 0;
 
-                                _fmpz_vec_scalar_submul_si(B->rows[kappa],
-                                                           B->rows[j], n, xx);
-                                if (U != NULL)
-                                {
-                                    _fmpz_vec_scalar_submul_si(U->rows
-                                                               [kappa],
-                                                               U->rows[j],
-                                                               U->c, xx);
-                                }
+                                red_rows[red_len] = j;
+                                red_xx[red_len] = xx;
+                                red_expo[red_len++] = 0;
 
                                 for (k = zeros + 1; k < j; k++)
                                 {
@@ -221,21 +264,9 @@ FUNC_HEAD
                             }
                             else
                             {
-                                _fmpz_vec_scalar_submul_si_2exp(B->rows
-                                                                [kappa],
-                                                                B->rows[j],
-                                                                n, xx,
-                                                                exponent);
-                                if (U != NULL)
-                                {
-                                    _fmpz_vec_scalar_submul_si_2exp(U->rows
-                                                                    [kappa],
-                                                                    U->rows
-                                                                    [j],
-                                                                    U->c,
-                                                                    xx,
-                                                                    exponent);
-                                }
+                                red_rows[red_len] = j;
+                                red_xx[red_len] = xx;
+                                red_expo[red_len++] = exponent;
 
                                 for (k = zeros + 1; k < j; k++)
                                 {
@@ -254,6 +285,10 @@ FUNC_HEAD
                 }
             }
 
+            /* the row operations of this pass, all at once */
+            _fmpz_lll_size_reduce(B, U, kappa, red_rows, red_xx, red_expo,
+                                                            red_len, n, fl);
+
             if (test)           /* Anything happened? */
             {
                 expo[kappa] =
@@ -277,6 +312,10 @@ FUNC_HEAD
             loops++;
         } while (test);
 
+        flint_free(red_rows);
+        flint_free(red_expo);
+        flint_free(red_xx);
+
 #if TYPE == 1
         if (d_is_nan(d_mat_entry(A->appSP, kappa, kappa)))
         {
@@ -12,11 +12,48 @@
 */
 
 #include "fmpz_lll.h"
+#include "thread_support.h"
 #ifdef GM
 #undef GM
 #endif
 #define GM ((fl->rt == Z_BASIS) ? A->exactSP : B)
 
+/*
+    The Gram entries of row kappa that are not known are independent of each
+    other; for long rows they are computed in parallel up front.
+*/
+typedef struct
+{
+    fmpz_mat_struct * B;
+    mpf_mat_struct * appB;
+    fmpz_gram_union * A;
+    int kappa;
+    int start;
+    int n;
+    flint_bitcnt_t prec;
+}
+_babai_mpf_gram_arg;
+
+static void
+_babai_mpf_gram_worker(slong i, _babai_mpf_gram_arg * arg)
+{
+    int kappa = arg->kappa, j = arg->start + i;
+    mpf * g = mpf_mat_entry(arg->A->appSP2, kappa, j);
+    fmpz_t ztmp;
+
+    if (mpf_cmp_d(g, DBL_MIN) != 0)
+        return;
+
+    if (!_mpf_vec_dot2(g, arg->appB->rows[kappa], arg->appB->rows[j],
+                                                          arg->n, arg->prec))
+    {
+        fmpz_init(ztmp);
+        _fmpz_vec_dot(ztmp, arg->B->rows[kappa], arg->B->rows[j], arg->n);
+        fmpz_get_mpf(g, ztmp);
+        fmpz_clear(ztmp);
+    }
+}
+
 int
 fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
                                mpf_mat_t mu, mpf_mat_t r, mpf * s,
@@ -32,6 +69,9 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
         double halfplus, onedothalfplus;
         ulong loops;
 
+        int * red_rows, * red_expo;
+        slong * red_xx, red_len;
+
         fmpz_init(ztmp);
 
         aa = (a > zeros) ? a : zeros + 1;
@@ -39,11 +79,34 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
         halfplus = (fl->eta + 0.5) / 2;
         onedothalfplus = 1.0 + halfplus;
 
+        red_rows = (int *) flint_malloc(FLINT_MAX(kappa, 1) * sizeof(int));
+        red_expo = (int *) flint_malloc(FLINT_MAX(kappa, 1) * sizeof(int));
+        red_xx = (slong *) flint_malloc(FLINT_MAX(kappa, 1) * sizeof(slong));
+
         loops = 0;
 
         do
         {
             test = 0;
+            red_len = 0;
+
+            if (kappa - aa > 1 && fl->thread_limit != 1 &&
+                (slong) (kappa - aa) * n >= FMPZ_LLL_PARALLEL_CUTOFF &&
+                flint_get_num_threads() > 1)
+            {
+                _babai_mpf_gram_arg garg;
+
+                garg.B = B;
+                garg.appB = appB;
+                garg.A = A;
+                garg.kappa = kappa;
+                garg.start = aa;
+                garg.n = n;
+                garg.prec = prec;
+
+                flint_parallel_do((do_func_t) _babai_mpf_gram_worker, &garg,
+                            kappa - aa, fl->thread_limit, FLINT_PARALLEL_UNIFORM);
+            }
 
             /* ************************************** */
             /* Step2: compute the GSO for stage kappa */
@@ -109,6 +172,9 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
                 if (new_max_expo > max_expo - SIZE_RED_FAILURE_THRESH)
                 {
                     fmpz_clear(ztmp);
+                    flint_free(red_rows);
+                    flint_free(red_expo);
+                    flint_free(red_xx);
                     return -1;
                 }
                 max_expo = new_max_expo;
@@ -139,14 +205,9 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
                                         mpf_mat_entry(mu, kappa, k),
                                         mpf_mat_entry(mu, j, k));
                             }
-                            _fmpz_vec_sub(B->rows[kappa], B->rows[kappa],
-                                          B->rows[j], n);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_sub(U->rows[kappa],
-                                              U->rows[kappa], U->rows[j],
-                                              U->c);
-                            }
+                            red_rows[red_len] = j;
+                            red_xx[red_len] = 1;
+                            red_expo[red_len++] = 0;
                         }
                         else    /* otherwise X is -1 */
                         {
@@ -156,14 +217,9 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
                                         mpf_mat_entry(mu, kappa, k),
                                         mpf_mat_entry(mu, j, k));
                             }
-                            _fmpz_vec_add(B->rows[kappa], B->rows[kappa],
-                                          B->rows[j], n);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_add(U->rows[kappa],
-                                              U->rows[kappa], U->rows[j],
-                                              U->c);
-                            }
+                            red_rows[red_len] = j;
+                            red_xx[red_len] = -1;
+                            red_expo[red_len++] = 0;
                         }
                     }
                     else        /* we must have |X| >= 2 */
@@ -192,17 +248,13 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
                         {
                             /* X is stored in an slong */
                             xx = flint_mpf_get_si(tmp);
-                            _fmpz_vec_scalar_submul_si(B->rows[kappa],
-                                                       B->rows[j], n, xx);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_scalar_submul_si(U->rows[kappa],
-                                                           U->rows[j],
-                                                           U->c, xx);
-                            }
+                            red_rows[red_len] = j;
+                            red_xx[red_len] = xx;
+                            red_expo[red_len++] = 0;
                         }
                         else
                         {
+                            /* the row operations commute, apply this now */
                             fmpz_set_mpf(ztmp, tmp);
                             _fmpz_vec_scalar_submul_fmpz(B->rows[kappa],
                                                          B->rows[j], n, ztmp);
@@ -218,6 +270,10 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
                 }
             }
 
+            /* the row operations of this pass, all at once */
+            _fmpz_lll_size_reduce(B, U, kappa, red_rows, red_xx, red_expo,
+                                                            red_len, n, fl);
+
             if (test)           /* Anything happened? */
             {
                 _fmpz_vec_get_mpf_vec(appB->rows[kappa], B->rows[kappa], n);
@@ -232,6 +288,10 @@ fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U,
             loops++;
         } while (test);
 
+        flint_free(red_rows);
+        flint_free(red_expo);
+        flint_free(red_xx);
+
         if (mpf_cmp_d(mpf_mat_entry(A->appSP2, kappa, kappa), DBL_MIN) == 0)
         {
             _mpf_vec_norm2(mpf_mat_entry(A->appSP2, kappa, kappa),
@@ -21,4 +21,5 @@ fmpz_lll_context_init(fmpz_lll_t fl, double delta, double eta, rep_type rt,
     fl->eta = eta;
     fl->rt = rt;
     fl->gt = gt;
+    fl->thread_limit = 0;
 }
@@ -20,4 +20,5 @@ fmpz_lll_context_init_default(fmpz_lll_t fl)
     fl->eta = 0.51;
     fl->rt = Z_BASIS;
     fl->gt = APPROX;
+    fl->thread_limit = 0;
 }
@@ -0,0 +1,110 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_vec.h"
+#include "fmpz_lll.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    fmpz_mat_struct * B;
+    fmpz_mat_struct * U;
+    int kappa;
+    const int * rows;
+    const slong * xx;
+    const int * expo;
+    slong len;
+    slong n;
+    slong num_blocks;
+}
+_size_reduce_arg;
+
+/* v[start, stop) -= sum_i xx[i] 2^expo[i] M[rows[i]][start, stop) */
+static void
+_size_reduce_cols(fmpz * v, fmpz ** M, const int * rows, const slong * xx,
+                           const int * expo, slong len, slong start, slong stop)
+{
+    slong i, m = stop - start;
+    const fmpz * w;
+
+    for (i = 0; i < len; i++)
+    {
+        w = M[rows[i]] + start;
+
+        if (expo[i] != 0)
+            _fmpz_vec_scalar_submul_si_2exp(v + start, w, m, xx[i], expo[i]);
+        else if (xx[i] == 1)
+            _fmpz_vec_sub(v + start, v + start, w, m);
+        else if (xx[i] == -1)
+            _fmpz_vec_add(v + start, v + start, w, m);
+        else
+            _fmpz_vec_scalar_submul_si(v + start, w, m, xx[i]);
+    }
+}
+
+/* block k of the columns of B followed by the columns of U */
+static void
+_size_reduce_worker(slong k, _size_reduce_arg * arg)
+{
+    slong Uc = (arg->U != NULL) ? arg->U->c : 0;
+    slong total = arg->n + Uc;
+    slong start = (k * total) / arg->num_blocks;
+    slong stop = ((k + 1) * total) / arg->num_blocks;
+
+    if (start < arg->n)
+        _size_reduce_cols(arg->B->rows[arg->kappa], arg->B->rows, arg->rows,
+                  arg->xx, arg->expo, arg->len, start, FLINT_MIN(stop, arg->n));
+
+    if (stop > arg->n)
+        _size_reduce_cols(arg->U->rows[arg->kappa], arg->U->rows, arg->rows,
+                      arg->xx, arg->expo, arg->len,
+                      FLINT_MAX(start, arg->n) - arg->n, stop - arg->n);
+}
+
+void
+_fmpz_lll_size_reduce(fmpz_mat_t B, fmpz_mat_t U, int kappa,
+                      const int * rows, const slong * xx, const int * expo,
+                      slong len, int n, const fmpz_lll_t fl)
+{
+    _size_reduce_arg arg;
+    slong total, num_threads;
+
+    if (len == 0)
+        return;
+
+    total = n + ((U != NULL) ? U->c : 0);
+
+    num_threads = flint_get_num_threads();
+    if (fl->thread_limit > 0)
+        num_threads = FLINT_MIN(num_threads, fl->thread_limit);
+
+    arg.B = B;
+    arg.U = U;
+    arg.kappa = kappa;
+    arg.rows = rows;
+    arg.xx = xx;
+    arg.expo = expo;
+    arg.len = len;
+    arg.n = n;
+    arg.num_blocks = 1;
+
+    if (num_threads > 1 && len * total >= FMPZ_LLL_PARALLEL_CUTOFF)
+    {
+        arg.num_blocks = FLINT_MIN(num_threads, total);
+        flint_parallel_do((do_func_t) _size_reduce_worker, &arg,
+                         arg.num_blocks, fl->thread_limit, FLINT_PARALLEL_UNIFORM);
+    }
+    else
+    {
+        _size_reduce_worker(0, &arg);
+    }
+}
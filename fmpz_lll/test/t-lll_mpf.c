@@ -24,6 +24,7 @@ main(void)
     fmpz_mat_t mat, mat2, U;
     fmpz_lll_t fl;
     flint_bitcnt_t bits;
+    slong max_threads = 5;
 
     FLINT_TEST_INIT(state);
 
@@ -41,6 +42,7 @@ main(void)
 
         fmpz_mat_init(mat, r, c);
         fmpz_lll_randtest(fl, state);
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
 
         bits = n_randint(state, 20) + 1;
         q = n_randint(state, 200) + 1;
@@ -138,6 +140,7 @@ main(void)
 
         fmpz_mat_init(mat, r, c);
         fmpz_lll_randtest(fl, state);
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
 
         bits = n_randint(state, 200) + 1;
 
@@ -239,6 +242,7 @@ main(void)
 
         fmpz_mat_init(mat, r, c);
         fmpz_lll_randtest(fl, state);
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
 
         fmpz_mat_randajtai(mat, state, 0.5);
 
@@ -330,6 +334,7 @@ main(void)
 
         fmpz_mat_init(mat, r, c);
         fmpz_lll_randtest(fl, state);
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
 
         bits = n_randint(state, 200) + 1;
         bits2 = n_randint(state, 5) + 1;
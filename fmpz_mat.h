@@ -237,12 +237,20 @@ FLINT_DLL void fmpz_mat_scalar_mod_fmpz(fmpz_mat_t B, const fmpz_mat_t A, const
 
 /* Multiplication */
 
+/*
+    Above this dimension fmpz_mat_mul recurses with Strassen multiplication,
+    which bounds the memory used by the multimodular products.
+*/
+#define FMPZ_MAT_MUL_STRASSEN_SPACE_CUTOFF 8000
+
 FLINT_DLL void fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B);
 
 FLINT_DLL void fmpz_mat_mul_classical(fmpz_mat_t C, const fmpz_mat_t A,
     const fmpz_mat_t B);
 
 FLINT_DLL void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B);
+FLINT_DLL void _fmpz_mat_mul_strassen_cutoff(fmpz_mat_t C, const fmpz_mat_t A,
+                                   const fmpz_mat_t B, slong cutoff);
 
 FLINT_DLL void fmpz_mat_mul_classical_inline(fmpz_mat_t C, const fmpz_mat_t A,
     const fmpz_mat_t B);
@@ -607,6 +615,15 @@ FLINT_DLL void fmpz_mat_multi_CRT_ui(fmpz_mat_t mat, nmod_mat_t * const residues
 
 /* HNF and SNF **************************************************************/
 
+/*
+    Row and column eliminations of the modular HNF and SNF algorithms are
+    split into blocks over threads once a step touches at least this many
+    limbs.
+*/
+#define FMPZ_MAT_ELIM_PARALLEL_CUTOFF 8192
+
+FLINT_DLL int _fmpz_mat_set_thread_limit(slong thread_limit);
+
 FLINT_DLL void fmpz_mat_hnf(fmpz_mat_t H, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_hnf_transform(fmpz_mat_t H, fmpz_mat_t U, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_hnf_classical(fmpz_mat_t H, const fmpz_mat_t A);
@@ -616,6 +633,10 @@ FLINT_DLL void fmpz_mat_hnf_minors_transform(fmpz_mat_t H, fmpz_mat_t U, const f
 FLINT_DLL void fmpz_mat_hnf_modular(fmpz_mat_t H, const fmpz_mat_t A, const fmpz_t D);
 FLINT_DLL void fmpz_mat_hnf_modular_eldiv(fmpz_mat_t A, const fmpz_t D);
 FLINT_DLL void fmpz_mat_hnf_pernet_stein(fmpz_mat_t H, const fmpz_mat_t A, flint_rand_t state);
+FLINT_DLL void fmpz_mat_hnf_modular_eldiv_threaded(fmpz_mat_t A,
+        const fmpz_t D, slong thread_limit);
+FLINT_DLL void fmpz_mat_hnf_pernet_stein_threaded(fmpz_mat_t H,
+        const fmpz_mat_t A, flint_rand_t state, slong thread_limit);
 FLINT_DLL int fmpz_mat_is_in_hnf(const fmpz_mat_t A);
 
 FLINT_DLL void fmpz_mat_snf(fmpz_mat_t S, const fmpz_mat_t A);
@@ -623,6 +644,8 @@ FLINT_DLL void fmpz_mat_snf_diagonal(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_kannan_bachem(fmpz_mat_t S, const fmpz_mat_t A);
 FLINT_DLL void fmpz_mat_snf_iliopoulos(fmpz_mat_t S, const fmpz_mat_t A,
         const fmpz_t mod);
+FLINT_DLL void fmpz_mat_snf_iliopoulos_threaded(fmpz_mat_t S,
+        const fmpz_mat_t A, const fmpz_t mod, slong thread_limit);
 FLINT_DLL int fmpz_mat_is_in_snf(const fmpz_mat_t A);
 
 /* Special matrices **********************************************************/
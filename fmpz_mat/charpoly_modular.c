@@ -88,6 +88,49 @@ void _fmpz_mat_charpoly_small(fmpz * rop, const fmpz_mat_t op)
     }
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * op;
+    const mp_limb_t * primes;
+    mp_limb_t * residues;
+    slong num_primes;
+    fmpz_comb_t comb;
+    fmpz * rop;
+}
+_charpoly_arg_struct;
+
+/* coefficient j of the charpoly mod primes[i] goes to residues[j*num_primes + i] */
+static void
+_charpoly_mod_worker(slong i, _charpoly_arg_struct * arg)
+{
+    slong j, n = arg->op->r;
+    nmod_mat_t mat;
+    nmod_poly_t poly;
+
+    nmod_mat_init(mat, n, n, arg->primes[i]);
+    nmod_poly_init(poly, arg->primes[i]);
+
+    fmpz_mat_get_nmod_mat(mat, arg->op);
+    nmod_mat_charpoly(poly, mat);
+
+    for (j = 0; j <= n; j++)
+        arg->residues[j*arg->num_primes + i] = nmod_poly_get_coeff_ui(poly, j);
+
+    nmod_mat_clear(mat);
+    nmod_poly_clear(poly);
+}
+
+static void
+_charpoly_crt_worker(slong j, _charpoly_arg_struct * arg)
+{
+    fmpz_comb_temp_t temp;
+
+    fmpz_comb_temp_init(temp, arg->comb);
+    fmpz_multi_CRT_ui(arg->rop + j, arg->residues + j*arg->num_primes,
+                                                           arg->comb, temp, 1);
+    fmpz_comb_temp_clear(temp);
+}
+
 void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
 {
     const slong n = op->r;
@@ -107,12 +150,13 @@ void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
             See Lemma 4.1 in Dumas, Pernet, and Wan, "Efficient computation 
             of the characteristic polynomial", 2008.
          */
-        slong bound;
+        slong bound, bits, num_primes, alloc;
 
         slong pbits  = FLINT_BITS - 1;
         mp_limb_t p = (UWORD(1) << pbits);
 
-        fmpz_t m;
+        mp_limb_t * primes, * residues;
+        _charpoly_arg_struct arg;
 
         /* Determine the bound in bits */
         {
@@ -140,30 +184,43 @@ void _fmpz_mat_charpoly_modular(fmpz * rop, const fmpz_mat_t op)
             bound = ceil( (n / 2.0) * (_log2(n) + 2.0 * t + 1.6669) );
         }
 
-        fmpz_init_set_ui(m, 1);
-
-        for ( ; fmpz_bits(m) < bound; )
+        /* Choose the primes */
+        num_primes = 0;
+        alloc = 16;
+        primes = flint_malloc(alloc*sizeof(mp_limb_t));
+        for (bits = 0; bits < bound; bits += pbits)
         {
-            nmod_mat_t mat;
-            nmod_poly_t poly;
+            if (num_primes == alloc)
+            {
+                alloc *= 2;
+                primes = flint_realloc(primes, alloc*sizeof(mp_limb_t));
+            }
 
             p = n_nextprime(p, 0);
+            primes[num_primes++] = p;
+        }
 
-            nmod_mat_init(mat, n, n, p);
-            nmod_poly_init(poly, p);
+        /* The characteristic polynomial modulo each prime, in parallel */
+        residues = flint_malloc((n + 1)*num_primes*sizeof(mp_limb_t));
 
-            fmpz_mat_get_nmod_mat(mat, op);
-            nmod_mat_charpoly(poly, mat);
+        arg.op = op;
+        arg.primes = primes;
+        arg.residues = residues;
+        arg.num_primes = num_primes;
 
-            _fmpz_poly_CRT_ui(rop, rop, n + 1, m, poly->coeffs, n + 1, poly->mod.n, poly->mod.ninv, 1);
+        flint_parallel_do((do_func_t) _charpoly_mod_worker, &arg, num_primes,
+                                                    0, FLINT_PARALLEL_DYNAMIC);
 
-            fmpz_mul_ui(m, m, p);
+        /* Combine the coefficients with a CRT tree, in parallel */
+        fmpz_comb_init(arg.comb, primes, num_primes);
+        arg.rop = rop;
 
-            nmod_mat_clear(mat);
-            nmod_poly_clear(poly);
-        }
+        flint_parallel_do((do_func_t) _charpoly_crt_worker, &arg, n + 1,
+                                                    0, FLINT_PARALLEL_UNIFORM);
 
-        fmpz_clear(m);
+        fmpz_comb_clear(arg.comb);
+        flint_free(residues);
+        flint_free(primes);
     }
 }
 
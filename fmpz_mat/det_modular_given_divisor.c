@@ -30,14 +30,41 @@ next_good_prime(const fmpz_t d, mp_limb_t p)
 }
 
 
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    const fmpz * d;
+    nmod_mat_struct * mats;
+    mp_limb_t * primes;
+    mp_limb_t * residues;
+}
+_det_worker_arg;
+
+/* residues[i] = det(A) / d mod primes[i] */
+static void
+_det_worker(slong i, _det_worker_arg * arg)
+{
+    nmod_mat_struct * Amod = arg->mats + i;
+    mp_limb_t p = arg->primes[i], xmod;
+
+    _nmod_mat_set_mod(Amod, p);
+    fmpz_mat_get_nmod_mat(Amod, arg->A);
+
+    xmod = _nmod_mat_det(Amod);
+    arg->residues[i] = n_mulmod2_preinv(xmod,
+        n_invmod(fmpz_fdiv_ui(arg->d, p), p), Amod->mod.n, Amod->mod.ninv);
+}
+
 void
 fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     const fmpz_t d, int proved)
 {
     fmpz_t bound, prod, stable_prod, x, xnew;
-    mp_limb_t p, xmod;
-    nmod_mat_t Amod;
-    slong n = A->r;
+    mp_limb_t p, * primes, * residues;
+    nmod_mat_struct * mats;
+    _det_worker_arg arg;
+    slong i, num, batch, n = A->r;
+    int done;
 
     if (n == 0)
     {
@@ -62,49 +89,88 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     fmpz_mul_ui(bound, bound, UWORD(2));  /* accomodate sign */
     fmpz_cdiv_q(bound, bound, d);
 
-    nmod_mat_init(Amod, n, n, 2);
-    fmpz_zero(x);
-    fmpz_one(prod);
-
+    /*
+        The determinants modulo a batch of primes, one per thread, are
+        computed in parallel; they are then added to x one at a time so
+        that the early termination test is done after every prime. No batch
+        is larger than the number of primes the bound needs.
+    */
 #if DEBUG_USE_SMALL_PRIMES
     p = UWORD(1);
 #else
     p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
 #endif
 
-    /* Compute x = det(A) / d */
-    while (fmpz_cmp(prod, bound) <= 0)
-    {
-        p = next_good_prime(d, p);
-        _nmod_mat_set_mod(Amod, p);
-        fmpz_mat_get_nmod_mat(Amod, A);
+    batch = FLINT_MAX(1, (fmpz_bits(bound) + FLINT_BIT_COUNT(p) - 2)
+                                                        / FLINT_BIT_COUNT(p));
+    batch = FLINT_MIN(batch, flint_get_num_threads());
+
+    primes = flint_malloc(batch*sizeof(mp_limb_t));
+    residues = flint_malloc(batch*sizeof(mp_limb_t));
+    mats = flint_malloc(batch*sizeof(nmod_mat_struct));
+    for (i = 0; i < batch; i++)
+        nmod_mat_init(mats + i, n, n, 2);
 
-        /* Compute x = det(A) / d mod p */
-        xmod = _nmod_mat_det(Amod);
-        xmod = n_mulmod2_preinv(xmod,
-            n_invmod(fmpz_fdiv_ui(d, p), p), Amod->mod.n, Amod->mod.ninv);
+    arg.A = A;
+    arg.d = d;
+    arg.mats = mats;
+    arg.primes = primes;
+    arg.residues = residues;
 
-        fmpz_CRT_ui(xnew, x, prod, xmod, p, 1);
+    fmpz_zero(x);
+    fmpz_one(prod);
 
-        if (fmpz_equal(xnew, x))
+    /* Compute x = det(A) / d */
+    done = (fmpz_cmp(prod, bound) > 0);
+    while (!done)
+    {
+        /* no more primes than the bound still needs */
+        fmpz_cdiv_q(xnew, bound, prod);
+        num = FLINT_MAX(1, (fmpz_bits(xnew) + FLINT_BIT_COUNT(p) - 2)
+                                                        / FLINT_BIT_COUNT(p));
+        num = FLINT_MIN(num, batch);
+
+        for (i = 0; i < num; i++)
         {
-            fmpz_mul_ui(stable_prod, stable_prod, p);
-            if (!proved && fmpz_bits(stable_prod) > 100)
-                break;
+            p = next_good_prime(d, p);
+            primes[i] = p;
         }
-        else
+
+        flint_parallel_do((do_func_t) _det_worker, &arg, num, 0,
+                                                       FLINT_PARALLEL_UNIFORM);
+
+        for (i = 0; i < num && !done; i++)
         {
-            fmpz_set_ui(stable_prod, p);
+            fmpz_CRT_ui(xnew, x, prod, residues[i], primes[i], 1);
+
+            if (fmpz_equal(xnew, x))
+            {
+                fmpz_mul_ui(stable_prod, stable_prod, primes[i]);
+                if (!proved && fmpz_bits(stable_prod) > 100)
+                    done = 1;
+            }
+            else
+            {
+                fmpz_set_ui(stable_prod, primes[i]);
+            }
+
+            fmpz_mul_ui(prod, prod, primes[i]);
+            fmpz_set(x, xnew);
+
+            if (fmpz_cmp(prod, bound) > 0)
+                done = 1;
         }
-
-        fmpz_mul_ui(prod, prod, p);
-        fmpz_set(x, xnew);
     }
 
     /* det(A) = x * d */
     fmpz_mul(det, x, d);
 
-    nmod_mat_clear(Amod);
+    for (i = 0; i < batch; i++)
+        nmod_mat_clear(mats + i);
+    flint_free(mats);
+    flint_free(primes);
+    flint_free(residues);
+
     fmpz_clear(bound);
     fmpz_clear(prod);
     fmpz_clear(stable_prod);
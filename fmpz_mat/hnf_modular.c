@@ -10,12 +10,93 @@
 */
 
 #include "fmpz_mat.h"
+#include "thread_support.h"
+
+/*
+    The operations of step k only depend on column k, so they are
+    determined first and then applied to the remaining columns, which are
+    split into blocks handled by separate threads.
+*/
+typedef struct
+{
+    fmpz_mat_struct * H;
+    slong k;
+    slong start;
+    slong len;
+    slong nblocks;
+    const slong * rows;     /* rows combined with row k */
+    slong nrows;
+    const fmpz * tr;        /* u, v, r1d, r2d for each of these rows */
+    const fmpz * u;         /* final scaling of row k */
+    const fmpz * q;         /* multiples of row k subtracted from rows < k */
+    const fmpz * R;
+    const fmpz * R2;
+}
+_hnf_modular_arg_t;
+
+static void
+_hnf_modular_worker(slong b, _hnf_modular_arg_t * arg)
+{
+    fmpz_mat_struct * H = arg->H;
+    slong k = arg->k, i, j, l, j0, j1;
+    const fmpz * R = arg->R, * R2 = arg->R2, * tr;
+    fmpz_t t;
+
+    j0 = arg->start + (b * arg->len) / arg->nblocks;
+    j1 = arg->start + ((b + 1) * arg->len) / arg->nblocks;
+
+    fmpz_init(t);
+
+    for (l = 0; l < arg->nrows; l++)
+    {
+        i = arg->rows[l];
+        tr = arg->tr + 4 * l;
+
+        for (j = j0; j < j1; j++)
+        {
+            fmpz_mul(t, tr + 0, fmpz_mat_entry(H, k, j));
+            fmpz_addmul(t, tr + 1, fmpz_mat_entry(H, i, j));
+            fmpz_mul(fmpz_mat_entry(H, i, j), tr + 2,
+                     fmpz_mat_entry(H, i, j));
+            fmpz_submul(fmpz_mat_entry(H, i, j), tr + 3,
+                        fmpz_mat_entry(H, k, j));
+            fmpz_mod(fmpz_mat_entry(H, i, j), fmpz_mat_entry(H, i, j), R);
+            if (fmpz_cmp(fmpz_mat_entry(H, i, j), R2) > 0)
+                fmpz_sub(fmpz_mat_entry(H, i, j),
+                         fmpz_mat_entry(H, i, j), R);
+            fmpz_mod(fmpz_mat_entry(H, k, j), t, R);
+            if (fmpz_cmp(fmpz_mat_entry(H, k, j), R2) > 0)
+                fmpz_sub(fmpz_mat_entry(H, k, j),
+                         fmpz_mat_entry(H, k, j), R);
+        }
+    }
+
+    for (j = j0; j < j1; j++)
+    {
+        fmpz_mul(fmpz_mat_entry(H, k, j), arg->u, fmpz_mat_entry(H, k, j));
+        fmpz_mod(fmpz_mat_entry(H, k, j), fmpz_mat_entry(H, k, j), R);
+    }
+
+    for (i = k - 1; i >= 0; i--)
+    {
+        for (j = j0; j < j1; j++)
+        {
+            fmpz_submul(fmpz_mat_entry(H, i, j), arg->q + i,
+                        fmpz_mat_entry(H, k, j));
+        }
+    }
+
+    fmpz_clear(t);
+}
 
 void
 fmpz_mat_hnf_modular(fmpz_mat_t H, const fmpz_mat_t A, const fmpz_t D)
 {
-    slong j, i, k, m, n;
-    fmpz_t R, R2, d, u, v, r1d, r2d, b, q;
+    slong i, k, m, n, nrows, nblocks;
+    slong * rows;
+    fmpz * tr, * q, * Hkk;
+    fmpz_t R, R2, d, u, v, t;
+    _hnf_modular_arg_t arg;
 
     m = fmpz_mat_nrows(A);
     n = fmpz_mat_ncols(A);
@@ -23,75 +104,100 @@ fmpz_mat_hnf_modular(fmpz_mat_t H, const fmpz_mat_t A, const fmpz_t D)
     fmpz_init_set(R, D);
     fmpz_init(R2);
     fmpz_init(u);
-    fmpz_init(u);
     fmpz_init(v);
     fmpz_init(d);
-    fmpz_init(r1d);
-    fmpz_init(r2d);
-    fmpz_init(b);
-    fmpz_init(q);
+    fmpz_init(t);
     fmpz_mat_set(H, A);
 
+    rows = (slong *) flint_malloc(FLINT_MAX(m, 1) * sizeof(slong));
+    tr = _fmpz_vec_init(4 * FLINT_MAX(m, 1));
+    q = _fmpz_vec_init(FLINT_MAX(n, 1));
+
     for (k = 0; k != n; k++)
     {
         fmpz_fdiv_q_2exp(R2, R, 1);
 
-        if (fmpz_is_zero(fmpz_mat_entry(H, k, k)))
-            fmpz_set(fmpz_mat_entry(H, k, k), R);
+        Hkk = fmpz_mat_entry(H, k, k);
+
+        if (fmpz_is_zero(Hkk))
+            fmpz_set(Hkk, R);
+
+        /* reduce rows i > k with row k mod R, column k first */
+        nrows = 0;
         for (i = k + 1; i != m; i++)
         {
-            /* reduce row i with row k mod R */
-            if (fmpz_is_zero(fmpz_mat_entry(H, i, k)))
+            fmpz * Hik = fmpz_mat_entry(H, i, k);
+            fmpz * c = tr + 4 * nrows;
+
+            if (fmpz_is_zero(Hik))
                 continue;
-            fmpz_xgcd(d, u, v, fmpz_mat_entry(H, k, k),
-                      fmpz_mat_entry(H, i, k));
-            fmpz_divexact(r1d, fmpz_mat_entry(H, k, k), d);
-            fmpz_divexact(r2d, fmpz_mat_entry(H, i, k), d);
-            for (j = k; j < n; j++)
-            {
-                fmpz_mul(b, u, fmpz_mat_entry(H, k, j));
-                fmpz_addmul(b, v, fmpz_mat_entry(H, i, j));
-                fmpz_mul(fmpz_mat_entry(H, i, j), r1d,
-                         fmpz_mat_entry(H, i, j));
-                fmpz_submul(fmpz_mat_entry(H, i, j), r2d,
-                            fmpz_mat_entry(H, k, j));
-                fmpz_mod(fmpz_mat_entry(H, i, j), fmpz_mat_entry(H, i, j), R);
-                if (fmpz_cmp(fmpz_mat_entry(H, i, j), R2) > 0)
-                    fmpz_sub(fmpz_mat_entry(H, i, j),
-                             fmpz_mat_entry(H, i, j), R);
-                fmpz_mod(fmpz_mat_entry(H, k, j), b, R);
-                if (fmpz_cmp(fmpz_mat_entry(H, k, j), R2) > 0)
-                    fmpz_sub(fmpz_mat_entry(H, k, j),
-                             fmpz_mat_entry(H, k, j), R);
-            }
-        }
 
-        fmpz_xgcd(d, u, v, fmpz_mat_entry(H, k, k), R);
-        for (j = k; j < n; j++)
-        {
-            fmpz_mul(fmpz_mat_entry(H, k, j), u, fmpz_mat_entry(H, k, j));
-            fmpz_mod(fmpz_mat_entry(H, k, j), fmpz_mat_entry(H, k, j), R);
+            fmpz_xgcd(d, c + 0, c + 1, Hkk, Hik);
+            fmpz_divexact(c + 2, Hkk, d);
+            fmpz_divexact(c + 3, Hik, d);
+            rows[nrows++] = i;
+
+            fmpz_mul(t, c + 0, Hkk);
+            fmpz_addmul(t, c + 1, Hik);
+            fmpz_mul(Hik, c + 2, Hik);
+            fmpz_submul(Hik, c + 3, Hkk);
+            fmpz_mod(Hik, Hik, R);
+            if (fmpz_cmp(Hik, R2) > 0)
+                fmpz_sub(Hik, Hik, R);
+            fmpz_mod(Hkk, t, R);
+            if (fmpz_cmp(Hkk, R2) > 0)
+                fmpz_sub(Hkk, Hkk, R);
         }
-        if (fmpz_is_zero(fmpz_mat_entry(H, k, k)))
-            fmpz_set(fmpz_mat_entry(H, k, k), R);
+
+        fmpz_xgcd(d, u, v, Hkk, R);
+        fmpz_mul(Hkk, u, Hkk);
+        fmpz_mod(Hkk, Hkk, R);
+        if (fmpz_is_zero(Hkk))
+            fmpz_set(Hkk, R);
 
         /* reduce higher entries of column k with row k */
         for (i = k - 1; i >= 0; i--)
         {
-            fmpz_fdiv_q(q, fmpz_mat_entry(H, i, k), fmpz_mat_entry(H, k, k));
-            for (j = k; j < n; j++)
-            {
-                fmpz_submul(fmpz_mat_entry(H, i, j), q,
-                            fmpz_mat_entry(H, k, j));
-            }
+            fmpz_fdiv_q(q + i, fmpz_mat_entry(H, i, k), Hkk);
+            fmpz_submul(fmpz_mat_entry(H, i, k), q + i, Hkk);
+        }
+
+        /* apply all of the above to the columns j > k */
+        arg.H = H;
+        arg.k = k;
+        arg.start = k + 1;
+        arg.len = n - k - 1;
+        arg.rows = rows;
+        arg.nrows = nrows;
+        arg.tr = tr;
+        arg.u = u;
+        arg.q = q;
+        arg.R = R;
+        arg.R2 = R2;
+
+        nblocks = 1;
+        if (arg.len > 1 && (nrows + k + 1) * arg.len * fmpz_size(R)
+                                              >= FMPZ_MAT_ELIM_PARALLEL_CUTOFF)
+            nblocks = FLINT_MIN(flint_get_num_threads(), arg.len);
+        arg.nblocks = nblocks;
+
+        if (arg.len > 0)
+        {
+            if (nblocks > 1)
+                flint_parallel_do((do_func_t) _hnf_modular_worker, &arg,
+                                           nblocks, 0, FLINT_PARALLEL_UNIFORM);
+            else
+                _hnf_modular_worker(0, &arg);
         }
+
         fmpz_divexact(R, R, d);
     }
 
-    fmpz_clear(b);
-    fmpz_clear(r2d);
-    fmpz_clear(r1d);
-    fmpz_clear(q);
+    flint_free(rows);
+    _fmpz_vec_clear(tr, 4 * FLINT_MAX(m, 1));
+    _fmpz_vec_clear(q, FLINT_MAX(n, 1));
+
+    fmpz_clear(t);
     fmpz_clear(d);
     fmpz_clear(v);
     fmpz_clear(u);
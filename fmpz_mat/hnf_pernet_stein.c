@@ -12,6 +12,7 @@
 #include "fmpz_mat.h"
 #include "fmpq_mat.h"
 #include "perm.h"
+#include "thread_support.h"
 
 static void
 add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t state)
@@ -20,8 +21,8 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     slong i, j, n, bits;
     fmpz_t den, tmp, one;
     fmpq_t num, alpha;
-    fmpz_mat_t Bu, B1, cols, k;
-    fmpq_mat_t H1_q, cols_q, x;
+    fmpz_mat_t Bu, Hx, B1, cols, k;
+    fmpq_mat_t x;
 
     n = B->r;
 
@@ -30,8 +31,6 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     fmpz_mat_init(cols, n, B->c - n);
     fmpz_mat_init(k, n, 1);
     fmpq_mat_init(x, n, B->c - n);
-    fmpq_mat_init(cols_q, n, B->c - n);
-    fmpq_mat_init(H1_q, n, n);
 
     for (i = 0; i < n; i++)
         for (j = 0; j < cols->c; j++)
@@ -124,14 +123,16 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
     }
 
     fmpq_clear(num);
-    fmpz_clear(den);
     fmpz_clear(one);
     fmpq_clear(alpha);
 
-    /* set cols = H1*x and place in position in H */
-    fmpq_mat_set_fmpz_mat(H1_q, H1);
-    fmpq_mat_mul(cols_q, H1_q, x);
-    fmpq_mat_get_fmpz_mat(cols, cols_q);
+    /* set cols = H1*x and place in position in H, the product being done
+       over the integers so that it uses the (threaded) fmpz_mat_mul */
+    fmpq_mat_get_fmpz_mat_matwise(cols, den, x);
+    fmpz_mat_init(Hx, n, cols->c);
+    fmpz_mat_mul(Hx, H1, cols);
+    fmpz_mat_scalar_divexact_fmpz(cols, Hx, den);
+    fmpz_mat_clear(Hx);
     for (i = 0; i < n; i++)
     {
         for (j = 0; j < n; j++)
@@ -140,20 +141,55 @@ add_columns(fmpz_mat_t H, const fmpz_mat_t B, const fmpz_mat_t H1, flint_rand_t
             fmpz_set(fmpz_mat_entry(H, i, j), fmpz_mat_entry(cols, i, j - n));
     }
 
-    fmpq_mat_clear(H1_q);
+    fmpz_clear(den);
     fmpq_mat_clear(x);
-    fmpq_mat_clear(cols_q);
     fmpz_mat_clear(k);
     fmpz_mat_clear(cols);
     fmpz_mat_clear(Bu);
 }
 
+/* reduce the entries above the pivot of row i, a block of rows at a time */
+typedef struct
+{
+    fmpz_mat_struct * H;
+    slong i;
+    slong col;
+    slong nblocks;
+}
+_reduce_above_arg_t;
+
+static void
+_reduce_above_worker(slong b, _reduce_above_arg_t * arg)
+{
+    fmpz_mat_struct * H = arg->H;
+    slong i = arg->i, col = arg->col, i2, j2, i0, i1;
+    fmpz_t q;
+
+    i0 = (b * i) / arg->nblocks;
+    i1 = ((b + 1) * i) / arg->nblocks;
+
+    fmpz_init(q);
+
+    for (i2 = i0; i2 < i1; i2++)
+    {
+        fmpz_fdiv_q(q, fmpz_mat_entry(H, i2, col), fmpz_mat_entry(H, i, col));
+        for (j2 = col; j2 < H->c; j2++)
+        {
+            fmpz_submul(fmpz_mat_entry(H, i2, j2), q,
+                    fmpz_mat_entry(H, i, j2));
+        }
+    }
+
+    fmpz_clear(q);
+}
+
 /* takes input matrix H with rows 0 to start_row - 1 in HNF to a HNF matrix */
 static void
 add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
 {
-    slong i, i2, j, j2, new_row, row;
-    fmpz_t b, d, u, v, r1d, r2d, q;
+    slong i, j, j2, new_row, row;
+    fmpz_t b, d, u, v, r1d, r2d;
+    _reduce_above_arg_t arg;
 
     fmpz_init(b);
     fmpz_init(d);
@@ -161,7 +197,6 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
     fmpz_init(v);
     fmpz_init(r1d);
     fmpz_init(r2d);
-    fmpz_init(q);
 
     for (row = start_row; row < H->r; row++)
     {
@@ -229,22 +264,26 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
         }
 
         /* reduce above pivot entries */
-        for (i = 0; i < num_pivots; i++)
+        for (i = 1; i < num_pivots; i++)
         {
-            for (i2 = 0; i2 < i; i2++)
-            {
-                fmpz_fdiv_q(q, fmpz_mat_entry(H, i2, pivots[i]),
-                        fmpz_mat_entry(H, i, pivots[i]));
-                for (j2 = pivots[i]; j2 < H->c; j2++)
-                {
-                    fmpz_submul(fmpz_mat_entry(H, i2, j2), q,
-                            fmpz_mat_entry(H, i, j2));
-                }
-            }
+            arg.H = H;
+            arg.i = i;
+            arg.col = pivots[i];
+            arg.nblocks = 1;
+
+            if (i > 1 && i * (H->c - pivots[i]) *
+                    fmpz_size(fmpz_mat_entry(H, i, pivots[i]))
+                                              >= FMPZ_MAT_ELIM_PARALLEL_CUTOFF)
+                arg.nblocks = FLINT_MIN(flint_get_num_threads(), i);
+
+            if (arg.nblocks > 1)
+                flint_parallel_do((do_func_t) _reduce_above_worker, &arg,
+                                      arg.nblocks, 0, FLINT_PARALLEL_UNIFORM);
+            else
+                _reduce_above_worker(0, &arg);
         }
     }
 
-    fmpz_clear(q);
     fmpz_clear(r2d);
     fmpz_clear(r1d);
     fmpz_clear(v);
@@ -253,18 +292,87 @@ add_rows(fmpz_mat_t H, slong start_row, slong *pivots, slong num_pivots)
     fmpz_clear(b);
 }
 
+typedef struct
+{
+    const fmpz_mat_struct * B;
+    const fmpz_mat_struct * c;
+    const fmpz_mat_struct * d;
+    const fmpz * u1;
+    const fmpz * u2;
+    mp_srcptr primes;
+    mp_ptr v1;
+    mp_ptr v2;
+}
+_double_det_arg_t;
+
+static mp_limb_t
+_nmod_mat_det_lu(nmod_mat_t A, slong * P)
+{
+    slong i, n = A->r;
+    mp_limb_t det = UWORD(1);
+
+    nmod_mat_lu(P, A, 0);
+    for (i = 0; i < n; i++)
+        det = n_mulmod2_preinv(det, nmod_mat_entry(A, i, i), A->mod.n,
+                A->mod.ninv);
+    if (_perm_parity(P, n) == 1)
+        det = nmod_neg(det, A->mod);
+
+    return det;
+}
+
+/* determinants modulo the l-th prime, divided by u1 and u2 */
+static void
+_double_det_worker(slong l, _double_det_arg_t * arg)
+{
+    slong i, j, n = arg->B->c;
+    mp_limb_t p = arg->primes[l], u1mod, u2mod;
+    slong * P;
+    nmod_mat_t M1, M2;
+
+    nmod_mat_init(M1, n, n, p);
+    nmod_mat_init(M2, n, n, p);
+    P = _perm_init(n);
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n - 1; j++)
+        {
+            nmod_mat_entry(M1, i, j) =
+                fmpz_fdiv_ui(fmpz_mat_entry(arg->B, j, i), p);
+            nmod_mat_entry(M2, i, j) = nmod_mat_entry(M1, i, j);
+        }
+        nmod_mat_entry(M1, i, n - 1) =
+            fmpz_fdiv_ui(fmpz_mat_entry(arg->c, 0, i), p);
+        nmod_mat_entry(M2, i, n - 1) =
+            fmpz_fdiv_ui(fmpz_mat_entry(arg->d, 0, i), p);
+    }
+
+    u1mod = fmpz_fdiv_ui(arg->u1, p);
+    u2mod = fmpz_fdiv_ui(arg->u2, p);
+
+    arg->v1[l] = n_mulmod2_preinv(_nmod_mat_det_lu(M1, P),
+                            n_invmod(u1mod, p), p, M1->mod.ninv);
+    arg->v2[l] = n_mulmod2_preinv(_nmod_mat_det_lu(M2, P),
+                            n_invmod(u2mod, p), p, M2->mod.ninv);
+
+    _perm_clear(P);
+    nmod_mat_clear(M1);
+    nmod_mat_clear(M2);
+}
+
 static void
 double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         const fmpz_mat_t d)
 {
-    slong i, j, n;
-    slong *P;
-    mp_limb_t p, u1mod, u2mod, v1mod, v2mod;
+    slong i, j, n, num_primes, alloc;
+    mp_limb_t p;
+    mp_ptr primes;
     fmpz_t bound, prod, s1, s2, t, u1, u2, v1, v2;
     fmpz_mat_t dt, Bt;
     fmpq_t tmpq;
     fmpq_mat_t x;
-    nmod_mat_t Btmod;
+    _double_det_arg_t arg;
 
     n = B->c;
 
@@ -347,60 +455,49 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
             fmpz_set(bound, s2);
         fmpz_mul_ui(bound, bound, UWORD(2));
 
+        /* choose the primes, then compute the determinants modulo each of
+           them in parallel */
+        num_primes = 0;
+        alloc = 0;
+        primes = NULL;
         fmpz_one(prod);
-        P = _perm_init(n);
-        nmod_mat_init(Btmod, n, n, 2);
         p = UWORD(1) << NMOD_MAT_OPTIMAL_MODULUS_BITS;
-        /* compute determinants divided by u1 and u2 */
         while (fmpz_cmp(prod, bound) <= 0)
         {
             p = n_nextprime(p, 0);
-            u1mod = fmpz_fdiv_ui(u1, p);
-            u2mod = fmpz_fdiv_ui(u2, p);
-            if (!(u1mod || u2mod))
+            if (fmpz_fdiv_ui(u1, p) == 0 || fmpz_fdiv_ui(u2, p) == 0)
                 continue;
-            _nmod_mat_set_mod(Btmod, p);
-            for (i = 0; i < n; i++)
-            {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(c, 0, i), p);
-            }
-            nmod_mat_lu(P, Btmod, 0);
-            v1mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v1mod = n_mulmod2_preinv(v1mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v1mod = nmod_neg(v1mod, Btmod->mod);
-
-            for (i = 0; i < n; i++)
+            if (num_primes >= alloc)
             {
-                for (j = 0; j < n - 1; j++)
-                    nmod_mat_entry(Btmod, i, j) =
-                        fmpz_fdiv_ui(fmpz_mat_entry(B, j, i), p);
-                nmod_mat_entry(Btmod, i, n - 1) =
-                    fmpz_fdiv_ui(fmpz_mat_entry(d, 0, i), p);
+                alloc = FLINT_MAX(2 * alloc, 16);
+                primes = (mp_ptr) flint_realloc(primes, 3 * alloc * sizeof(mp_limb_t));
             }
-            nmod_mat_lu(P, Btmod, 0);
-            v2mod = UWORD(1);
-            for (i = 0; i < n; i++)
-                v2mod = n_mulmod2_preinv(v2mod, nmod_mat_entry(Btmod, i, i), p,
-                        Btmod->mod.ninv);
-            if (_perm_parity(P, n) == 1)
-                v2mod = nmod_neg(v2mod, Btmod->mod);
-
-            v1mod = n_mulmod2_preinv(v1mod, n_invmod(u1mod, p), p,
-                    Btmod->mod.ninv);
-            v2mod = n_mulmod2_preinv(v2mod, n_invmod(u2mod, p), p,
-                    Btmod->mod.ninv);
-            fmpz_CRT_ui(v1, v1, prod, v1mod, p, 1);
-            fmpz_CRT_ui(v2, v2, prod, v2mod, p, 1);
+            primes[num_primes++] = p;
             fmpz_mul_ui(prod, prod, p);
         }
 
+        arg.B = B;
+        arg.c = c;
+        arg.d = d;
+        arg.u1 = u1;
+        arg.u2 = u2;
+        arg.primes = primes;
+        arg.v1 = primes + alloc;
+        arg.v2 = primes + 2 * alloc;
+
+        flint_parallel_do((do_func_t) _double_det_worker, &arg, num_primes,
+                                                  0, FLINT_PARALLEL_UNIFORM);
+
+        fmpz_one(prod);
+        for (i = 0; i < num_primes; i++)
+        {
+            fmpz_CRT_ui(v1, v1, prod, arg.v1[i], primes[i], 1);
+            fmpz_CRT_ui(v2, v2, prod, arg.v2[i], primes[i], 1);
+            fmpz_mul_ui(prod, prod, primes[i]);
+        }
+
+        flint_free(primes);
+
         fmpz_mul(d1, u1, v1);
         fmpz_mul(d2, u2, v2);
 
@@ -413,8 +510,6 @@ double_det(fmpz_t d1, fmpz_t d2, const fmpz_mat_t B, const fmpz_mat_t c,
         fmpz_clear(v1);
         fmpz_clear(v2);
         fmpz_clear(t);
-        _perm_clear(P);
-        nmod_mat_clear(Btmod);
     }
     else                        /* can't use the clever method above so naively compute both dets */
     {
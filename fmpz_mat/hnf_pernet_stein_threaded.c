@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_mat.h"
+
+void
+fmpz_mat_hnf_pernet_stein_threaded(fmpz_mat_t H, const fmpz_mat_t A,
+                                       flint_rand_t state, slong thread_limit)
+{
+    int nw_save = _fmpz_mat_set_thread_limit(thread_limit);
+    fmpz_mat_hnf_pernet_stein(H, A, state);
+    flint_reset_num_workers(nw_save);
+}
@@ -11,6 +11,7 @@
 */
 
 #include "fmpz_mat.h"
+#include "fft_tuning.h"
 
 void _fmpz_mat_mul_small_1(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
 {
@@ -102,6 +103,22 @@ void _fmpz_mat_mul_small_2b(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B
     }
 }
 
+/*
+    the residues of the multimodular algorithm take several times the space
+    of the output, strassen cuts this down by a factor 4 per level
+*/
+static void
+_fmpz_mat_mul_multi_mod_or_strassen(fmpz_mat_t C, const fmpz_mat_t A,
+                              const fmpz_mat_t B, int sign, flint_bitcnt_t bits)
+{
+    slong dim = FLINT_MIN(FLINT_MIN(A->r, A->c), B->c);
+
+    if (dim > FMPZ_MAT_MUL_STRASSEN_SPACE_CUTOFF)
+        fmpz_mat_mul_strassen(C, A, B);
+    else
+        _fmpz_mat_mul_multi_mod(C, A, B, sign, bits);
+}
+
 void
 fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
 {
@@ -152,7 +169,6 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
 
     dim = FLINT_MIN(ar, bc);
     dim = FLINT_MIN(dim, br);
-    /* TODO: for space reasons maybe just call strassen here if dim > 10000 */
 
     abits = fmpz_mat_max_bits(A);
     bbits = fmpz_mat_max_bits(B);
@@ -232,7 +248,7 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
             }
             else if (cbits > SMALL_FMPZ_BITCOUNT_MAX && dim - 4000 > limit)
             {
-                _fmpz_mat_mul_multi_mod(C, A, B, sign, cbits);
+                _fmpz_mat_mul_multi_mod_or_strassen(C, A, B, sign, cbits);
                 return;
             }
         }
@@ -259,7 +275,7 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
             limit = limit*limit*flint_get_num_threads();
             if (dim - 300 > limit)
             {
-                _fmpz_mat_mul_multi_mod(C, A, B, sign, cbits);
+                _fmpz_mat_mul_multi_mod_or_strassen(C, A, B, sign, cbits);
                 return;
             }
         }
@@ -269,9 +285,9 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
     }
     else
     {
-        if (dim >= 3 * FLINT_BIT_COUNT(cbits))  /* tuning param */
-            _fmpz_mat_mul_multi_mod(C, A, B, sign, cbits);
-        else if (abits >= 500 && bbits >= 500 && dim >= 8)  /* tuning param */
+        if (dim >= FMPZ_MAT_MUL_MULTI_MOD_CUTOFF * FLINT_BIT_COUNT(cbits))
+            _fmpz_mat_mul_multi_mod_or_strassen(C, A, B, sign, cbits);
+        else if (abits >= 500 && bbits >= 500 && dim >= FMPZ_MAT_MUL_STRASSEN_CUTOFF)
             fmpz_mat_mul_strassen(C, A, B);
         else
             fmpz_mat_mul_classical_inline(C, A, B);
@@ -32,24 +32,61 @@ typedef struct {
     const fmpz_comb_struct * comb;
     slong num_primes;
     mp_ptr primes;
+    mp_ptr pows;
+    slong limbs;
     int sign;
 } _worker_arg;
 
+/* entries are reduced and reconstructed in blocks of this many columns */
+#define MULTI_MOD_BLOCK 32
 
-static void _mod_worker(void * varg)
+/*
+    Reduce x using the table w[i] = 2^(FLINT_BITS*i) mod n: the limbs of x
+    are accumulated against w and reduced once at the end. Only w[0] = 1 is
+    nonzero for the power of two modulus, and the other moduli have at most
+    NMOD_MAT_OPTIMAL_MODULUS_BITS bits, so sixteen products fit in two limbs.
+*/
+static mp_limb_t
+_fmpz_get_nmod_pows(const fmpz_t x, mp_srcptr w, nmod_t mod)
 {
-    _worker_arg * arg = (_worker_arg *) varg;
-    slong i, j, l;
-    slong k = arg->k;
-    slong n = arg->n;
-    slong Astartrow = arg->Astartrow;
-    slong Astoprow = arg->Astoprow;
-    slong Bstartrow = arg->Bstartrow;
-    slong Bstoprow = arg->Bstoprow;
-    fmpz ** Arows = arg->Arows;
-    fmpz ** Brows = arg->Brows;
-    nmod_mat_t * mod_A = arg->mod_A;
-    nmod_mat_t * mod_B = arg->mod_B;
+    fmpz c = *x;
+    mp_limb_t r, hi, mid, lo, ph, pl;
+    mp_srcptr d;
+    slong i, stop, size;
+
+    if (!COEFF_IS_MPZ(c))
+    {
+        NMOD_RED(r, FLINT_ABS(c), mod);
+        return (c < 0) ? nmod_neg(r, mod) : r;
+    }
+
+    size = COEFF_TO_PTR(c)->_mp_size;
+    d = COEFF_TO_PTR(c)->_mp_d;
+
+    hi = mid = lo = 0;
+    for (i = 0; i < FLINT_ABS(size); )
+    {
+        mp_limb_t s1 = 0, s0 = 0;
+
+        for (stop = FLINT_MIN(i + 16, FLINT_ABS(size)); i < stop; i++)
+        {
+            umul_ppmm(ph, pl, d[i], w[i]);
+            add_ssaaaa(s1, s0, s1, s0, ph, pl);
+        }
+
+        add_sssaaaaaa(hi, mid, lo, hi, mid, lo, 0, s1, s0);
+    }
+
+    NMOD_RED3(r, hi, mid, lo, mod);
+    return (size < 0) ? nmod_neg(r, mod) : r;
+}
+
+/* rows [start, stop) of the r x c matrix with the given rows, all primes */
+static void
+_fmpz_rows_multi_mod(nmod_mat_t * mod_A, fmpz ** Arows, slong start,
+                                      slong stop, slong c, _worker_arg * arg)
+{
+    slong i, j, l, jj, jstop;
     slong num_primes = arg->num_primes;
     const fmpz_comb_struct * comb = arg->comb;
 
@@ -58,23 +95,21 @@ static void _mod_worker(void * varg)
         mp_limb_t * residues;
         fmpz_comb_temp_t comb_temp;
 
-        residues = FLINT_ARRAY_ALLOC(num_primes, mp_limb_t);
+        residues = FLINT_ARRAY_ALLOC(MULTI_MOD_BLOCK*num_primes, mp_limb_t);
         fmpz_comb_temp_init(comb_temp, comb);
 
-        for (i = Astartrow; i < Astoprow; i++)
-        for (j = 0; j < k; j++)
+        for (i = start; i < stop; i++)
+        for (jj = 0; jj < c; jj += MULTI_MOD_BLOCK)
         {
-            fmpz_multi_mod_ui(residues, &Arows[i][j], comb, comb_temp);
-            for (l = 0; l < num_primes; l++)
-                mod_A[l]->rows[i][j] = residues[l];
-        }
+            jstop = FLINT_MIN(jj + MULTI_MOD_BLOCK, c);
+
+            for (j = jj; j < jstop; j++)
+                fmpz_multi_mod_ui(residues + (j - jj)*num_primes,
+                                               &Arows[i][j], comb, comb_temp);
 
-        for (i = Bstartrow; i < Bstoprow; i++)
-        for (j = 0; j < n; j++)
-        {
-            fmpz_multi_mod_ui(residues, &Brows[i][j], comb, comb_temp);
             for (l = 0; l < num_primes; l++)
-                mod_B[l]->rows[i][j] = residues[l];
+                for (j = jj; j < jstop; j++)
+                    mod_A[l]->rows[i][j] = residues[(j - jj)*num_primes + l];
         }
 
         flint_free(residues);
@@ -82,28 +117,39 @@ static void _mod_worker(void * varg)
     }
     else
     {
-        for (i = Astartrow; i < Astoprow; i++)
-        for (j = 0; j < k; j++)
+        for (i = start; i < stop; i++)
+        for (l = 0; l < num_primes; l++)
         {
-            for (l = 0; l < num_primes; l++)
-                nmod_mat_entry(mod_A[l], i, j) = fmpz_get_nmod(&Arows[i][j],
-                                                                mod_A[l]->mod);
-        }
+            mp_ptr r = mod_A[l]->rows[i];
+            mp_srcptr w = arg->pows + l*arg->limbs;
+            nmod_t mod = mod_A[l]->mod;
 
-        for (i = Bstartrow; i < Bstoprow; i++)
-        for (j = 0; j < n; j++)
-        {
-            for (l = 0; l < num_primes; l++)
-                nmod_mat_entry(mod_B[l], i, j) = fmpz_get_nmod(&Brows[i][j],
-                                                                mod_A[l]->mod);
+            for (j = 0; j < c; j++)
+                r[j] = _fmpz_get_nmod_pows(&Arows[i][j], w, mod);
         }
     }
 }
 
+
+static void _mod_worker(void * varg)
+{
+    _worker_arg * arg = (_worker_arg *) varg;
+
+    _fmpz_rows_multi_mod(arg->mod_A, arg->Arows, arg->Astartrow,
+                                                 arg->Astoprow, arg->k, arg);
+    _fmpz_rows_multi_mod(arg->mod_B, arg->Brows, arg->Bstartrow,
+                                                 arg->Bstoprow, arg->n, arg);
+}
+
+static void _mul_worker(slong i, _worker_arg * arg)
+{
+    nmod_mat_mul(arg->mod_C[i], arg->mod_A[i], arg->mod_B[i]);
+}
+
 static void _crt_worker(void * varg)
 {
     _worker_arg * arg = (_worker_arg *) varg;
-    slong i, j, l;
+    slong i, j, l, jj, jstop;
     slong n = arg->n;
     slong Cstartrow = arg->Cstartrow;
     slong Cstoprow = arg->Cstoprow;
@@ -121,16 +167,21 @@ static void _crt_worker(void * varg)
         mp_limb_t * residues;
         fmpz_comb_temp_t comb_temp;
 
-        residues = FLINT_ARRAY_ALLOC(num_primes, mp_limb_t);
+        residues = FLINT_ARRAY_ALLOC(MULTI_MOD_BLOCK*num_primes, mp_limb_t);
         fmpz_comb_temp_init(comb_temp, comb);
 
         for (i = Cstartrow; i < Cstoprow; i++)
-        for (j = 0; j < n; j++)
+        for (jj = 0; jj < n; jj += MULTI_MOD_BLOCK)
         {
+            jstop = FLINT_MIN(jj + MULTI_MOD_BLOCK, n);
+
             for (l = 0; l < num_primes; l++)
-                residues[l] = mod_C[l]->rows[i][j];
+                for (j = jj; j < jstop; j++)
+                    residues[(j - jj)*num_primes + l] = mod_C[l]->rows[i][j];
 
-            fmpz_multi_CRT_ui(&Crows[i][j], residues, comb, comb_temp, sign);
+            for (j = jj; j < jstop; j++)
+                fmpz_multi_CRT_ui(&Crows[i][j], residues + (j - jj)*num_primes,
+                                                     comb, comb_temp, sign);
         }
 
         flint_free(residues);
@@ -212,7 +263,7 @@ static void _crt_worker(void * varg)
     }
     else
     {
-        mp_ptr M, Ns, T, U;
+        mp_ptr M, Ns, Ts, T, U;
         mp_size_t Msize, Nsize;
         mp_limb_t cy, ri;
 
@@ -233,7 +284,7 @@ static void _crt_worker(void * varg)
         Nsize = Msize + 2;
 
         Ns = FLINT_ARRAY_ALLOC(Nsize*num_primes, mp_limb_t);
-        T = FLINT_ARRAY_ALLOC(Nsize, mp_limb_t);
+        Ts = FLINT_ARRAY_ALLOC(Nsize*MULTI_MOD_BLOCK, mp_limb_t);
         U = FLINT_ARRAY_ALLOC(Nsize, mp_limb_t);
 
         for (i = 0; i < num_primes; i++)
@@ -247,35 +298,50 @@ static void _crt_worker(void * varg)
             Ns[i*Nsize + Msize] = mpn_mul_1(Ns + i*Nsize, Ns + i*Nsize, Msize, ri);
         }
 
+        /* the sums for a block of a row are accumulated prime by prime */
         for (i = Cstartrow; i < Cstoprow; i++)
-        for (j = 0; j < n; j++)
+        for (jj = 0; jj < n; jj += MULTI_MOD_BLOCK)
         {
-            ri = nmod_mat_entry(mod_C[0], i, j);
-            FLINT_ASSERT(Nsize > 1);
-            T[Nsize - 1] = mpn_mul_1(T, Ns, Nsize - 1, ri);
+            jstop = FLINT_MIN(jj + MULTI_MOD_BLOCK, n);
 
-            for (l = 1; l < num_primes; l++)
+            FLINT_ASSERT(Nsize > 1);
+            for (j = jj; j < jstop; j++)
             {
-                ri = nmod_mat_entry(mod_C[l], i, j);
-                T[Nsize - 1] += mpn_addmul_1(T, Ns + l*Nsize, Nsize - 1, ri);
+                T = Ts + (j - jj)*Nsize;
+                ri = nmod_mat_entry(mod_C[0], i, j);
+                T[Nsize - 1] = mpn_mul_1(T, Ns, Nsize - 1, ri);
             }
 
-            mpn_tdiv_qr(U, T, 0, T, Nsize, M, Msize);
-
-            if (sign && (mpn_sub_n(U, M, T, Msize), mpn_cmp(U, T, Msize) < 0))
+            for (l = 1; l < num_primes; l++)
             {
-                fmpz_set_ui_array(&Crows[i][j], U, Msize);
-                fmpz_neg(&Crows[i][j], &Crows[i][j]);
+                for (j = jj; j < jstop; j++)
+                {
+                    T = Ts + (j - jj)*Nsize;
+                    ri = nmod_mat_entry(mod_C[l], i, j);
+                    T[Nsize - 1] += mpn_addmul_1(T, Ns + l*Nsize, Nsize - 1, ri);
+                }
             }
-            else
+
+            for (j = jj; j < jstop; j++)
             {
-                fmpz_set_ui_array(&Crows[i][j], T, Msize);
+                T = Ts + (j - jj)*Nsize;
+                mpn_tdiv_qr(U, T, 0, T, Nsize, M, Msize);
+
+                if (sign && (mpn_sub_n(U, M, T, Msize), mpn_cmp(U, T, Msize) < 0))
+                {
+                    fmpz_set_ui_array(&Crows[i][j], U, Msize);
+                    fmpz_neg(&Crows[i][j], &Crows[i][j]);
+                }
+                else
+                {
+                    fmpz_set_ui_array(&Crows[i][j], T, Msize);
+                }
             }
         }
 
         flint_free(M);
         flint_free(Ns);
-        flint_free(T);
+        flint_free(Ts);
         flint_free(U);
     }
 }
@@ -288,9 +354,10 @@ void _fmpz_mat_mul_multi_mod(
     int sign,
     flint_bitcnt_t bits)
 {
-    slong i, start, stop;
+    slong i, j, start, stop;
     slong m, k, n;
     flint_bitcnt_t primes_bits;
+    slong Abits, Bbits;
     _worker_arg mainarg;
     _worker_arg * args;
     fmpz_comb_t comb;
@@ -357,11 +424,30 @@ void _fmpz_mat_mul_multi_mod(
         /* use comb */
         fmpz_comb_init(comb, mainarg.primes, mainarg.num_primes);
         mainarg.comb = comb;
+        mainarg.pows = NULL;
     }
     else
     {
-        /* don't use comb */
+        /* don't use comb, reduce with tables of powers of 2^FLINT_BITS */
         mainarg.comb = NULL;
+        /* the table covers the inputs, whose size is not bounded by bits */
+        Abits = FLINT_ABS(fmpz_mat_max_bits(A));
+        Bbits = FLINT_ABS(fmpz_mat_max_bits(B));
+        mainarg.limbs = (FLINT_MAX(Abits, Bbits) + FLINT_BITS - 1)/FLINT_BITS;
+        mainarg.limbs = FLINT_MAX(mainarg.limbs, 1);
+        mainarg.pows = FLINT_ARRAY_ALLOC(mainarg.num_primes*mainarg.limbs,
+                                                                   mp_limb_t);
+        for (i = 0; i < mainarg.num_primes; i++)
+        {
+            nmod_t mod = mainarg.mod_A[i]->mod;
+            mp_ptr w = mainarg.pows + i*mainarg.limbs;
+            mp_limb_t t;
+
+            NMOD_RED2(t, UWORD(1), UWORD(0), mod);
+            w[0] = 1;
+            for (j = 1; j < mainarg.limbs; j++)
+                w[j] = nmod_mul(w[j - 1], t, mod);
+        }
     }
 
     /* limit on the number of threads */
@@ -411,9 +497,22 @@ mod_single:
         flint_free(args);
     }
 
-    /* mul */
-    for (i = 0; i < mainarg.num_primes; i++)
-        nmod_mat_mul(mainarg.mod_C[i], mainarg.mod_A[i], mainarg.mod_B[i]);
+    /*
+        mul: with at least as many primes as threads, the products are done
+        concurrently, each with one thread, otherwise one after the other
+        using the threaded nmod_mat_mul
+    */
+    if (mainarg.num_primes > 1 &&
+        mainarg.num_primes >= flint_get_num_threads())
+    {
+        flint_parallel_do((do_func_t) _mul_worker, &mainarg,
+                          mainarg.num_primes, 0, FLINT_PARALLEL_DYNAMIC);
+    }
+    else
+    {
+        for (i = 0; i < mainarg.num_primes; i++)
+            nmod_mat_mul(mainarg.mod_C[i], mainarg.mod_A[i], mainarg.mod_B[i]);
+    }
 
 
     /* limit on the number of threads */
@@ -462,6 +561,8 @@ crt_single:
     /* Cleanup */
     if (mainarg.comb != NULL)
         fmpz_comb_clear(comb);
+    else
+        flint_free(mainarg.pows);
 
     for (i = 0; i < mainarg.num_primes; i++)
     {
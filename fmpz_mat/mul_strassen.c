@@ -14,9 +14,59 @@
 #include "fmpz_vec.h"
 #include "flint.h"
 
-void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
+/*
+    The temporaries X1 and X2 of all recursion levels are taken from a
+    single array of fmpz's allocated by the top level call: for n x n
+    matrices this is about 2n^2/3 entries in total, and no fmpz's are
+    allocated or freed inside the recursion.
+*/
+
+static slong
+_fmpz_mat_mul_strassen_scratch(slong a, slong b, slong c, slong cutoff)
 {
-    slong a, b, c;
+    slong anr = a / 2, anc = b / 2, bnc = c / 2;
+    slong s = anr * FLINT_MAX(bnc, anc) + anc * bnc;
+
+    if (FLINT_MIN(FLINT_MIN(anr, anc), bnc) > cutoff)
+        s += _fmpz_mat_mul_strassen_scratch(anr, anc, bnc, cutoff);
+
+    return s;
+}
+
+static void
+_fmpz_mat_scratch_init(fmpz_mat_t X, fmpz * T, slong r, slong c)
+{
+    slong i;
+
+    X->entries = T;
+    X->r = r;
+    X->c = c;
+    X->rows = (fmpz **) flint_malloc(r * sizeof(fmpz *));
+
+    for (i = 0; i < r; i++)
+        X->rows[i] = T + i * c;
+}
+
+static void
+_fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A,
+                                 const fmpz_mat_t B, fmpz * T, slong cutoff);
+
+/* the products of the halves recurse while they are large enough */
+static void
+_fmpz_mat_mul_half(fmpz_mat_t C, const fmpz_mat_t A,
+                                  const fmpz_mat_t B, fmpz * T, slong cutoff)
+{
+    if (FLINT_MIN(FLINT_MIN(A->r, A->c), B->c) > cutoff)
+        _fmpz_mat_mul_strassen(C, A, B, T, cutoff);
+    else
+        fmpz_mat_mul(C, A, B);
+}
+
+static void
+_fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A,
+                                  const fmpz_mat_t B, fmpz * T, slong cutoff)
+{
+    slong a, b, c, i, j;
     slong anr, anc, bnr, bnc;
 
     fmpz_mat_t A11, A12, A21, A22;
@@ -28,12 +78,6 @@ void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
     b = A->c;
     c = B->c;
 
-    if (a <= 4 || b <= 4 || c <= 4)
-    {
-        fmpz_mat_mul(C, A, B);
-        return;
-    }
-
     anr = a / 2;
     anc = b / 2;
     bnr = anc;
@@ -54,45 +98,52 @@ void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
     fmpz_mat_window_init(C21, C, anr, 0, 2*anr, bnc);
     fmpz_mat_window_init(C22, C, anr, bnc, 2*anr, 2*bnc);
 
-    fmpz_mat_init(X1, anr, FLINT_MAX(bnc, anc));
-    fmpz_mat_init(X2, anc, bnc);
+    _fmpz_mat_scratch_init(X1, T, anr, FLINT_MAX(bnc, anc));
+    T += anr * FLINT_MAX(bnc, anc);
+    _fmpz_mat_scratch_init(X2, T, anc, bnc);
+    T += anc * bnc;
 
     X1->c = anc;
 
+    /*
+        See Jean-Guillaume Dumas, Clement Pernet, Wei Zhou; "Memory
+        efficient scheduling of Strassen-Winograd's matrix multiplication
+        algorithm"; https://arxiv.org/pdf/0707.2347v3 for reference on the
+        used operation scheduling.
+    */
+
     fmpz_mat_sub(X1, A11, A21);
     fmpz_mat_sub(X2, B22, B12);
-    fmpz_mat_mul(C21, X1, X2);
+    _fmpz_mat_mul_half(C21, X1, X2, T, cutoff);
 
     fmpz_mat_add(X1, A21, A22);
     fmpz_mat_sub(X2, B12, B11);
-    fmpz_mat_mul(C22, X1, X2);
+    _fmpz_mat_mul_half(C22, X1, X2, T, cutoff);
 
     fmpz_mat_sub(X1, X1, A11);
     fmpz_mat_sub(X2, B22, X2);
-    fmpz_mat_mul(C12, X1, X2);
+    _fmpz_mat_mul_half(C12, X1, X2, T, cutoff);
 
     fmpz_mat_sub(X1, A12, X1);
-    fmpz_mat_mul(C11, X1, B22);
+    _fmpz_mat_mul_half(C11, X1, B22, T, cutoff);
 
     X1->c = bnc;
-    fmpz_mat_mul(X1, A11, B11);
+    _fmpz_mat_mul_half(X1, A11, B11, T, cutoff);
     fmpz_mat_add(C12, X1, C12);
     fmpz_mat_add(C21, C12, C21);
     fmpz_mat_add(C12, C12, C22);
     fmpz_mat_add(C22, C21, C22);
     fmpz_mat_add(C12, C12, C11);
     fmpz_mat_sub(X2, X2, B21);
-    fmpz_mat_mul(C11, A22, X2);
-
-    fmpz_mat_clear(X2);
+    _fmpz_mat_mul_half(C11, A22, X2, T, cutoff);
 
     fmpz_mat_sub(C21, C21, C11);
-    fmpz_mat_mul(C11, A12, B21);
+    _fmpz_mat_mul_half(C11, A12, B21, T, cutoff);
 
     fmpz_mat_add(C11, X1, C11);
 
-    X1->c = FLINT_MAX(bnc, anc);
-    fmpz_mat_clear(X1);
+    flint_free(X1->rows);
+    flint_free(X2->rows);
 
     fmpz_mat_window_clear(A11);
     fmpz_mat_window_clear(A12);
@@ -109,7 +160,7 @@ void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
     fmpz_mat_window_clear(C21);
     fmpz_mat_window_clear(C22);
 
-    if (c > 2*bnc) 
+    if (c > 2*bnc) /* A by last col of B -> last col of C */
     {
         fmpz_mat_t Bc, Cc;
         fmpz_mat_window_init(Bc, B, 0, 2*bnc, b, c);
@@ -119,7 +170,7 @@ void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
         fmpz_mat_window_clear(Cc);
     }
 
-    if (a > 2*anr) 
+    if (a > 2*anr) /* last row of A by B -> last row of C */
     {
         fmpz_mat_t Ar, Cr;
         fmpz_mat_window_init(Ar, A, 2*anr, 0, a, b);
@@ -129,24 +180,39 @@ void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
         fmpz_mat_window_clear(Cr);
     }
 
-    if (b > 2*anc) 
+    if (b > 2*anc) /* last col of A by last row of B -> C, in place */
     {
-        fmpz_mat_t Ac, Br, Cb, tmp;
-        slong mt, nt;
-
-        fmpz_mat_window_init(Ac, A, 0, 2*anc, 2*anr, b);
-        fmpz_mat_window_init(Br, B, 2*bnr, 0, b, 2*bnc);
-        fmpz_mat_window_init(Cb, C, 0, 0, 2*anr, 2*bnc);
-        
-        mt = Ac->r;
-        nt = Br->c;
-        
-        fmpz_mat_init(tmp, mt, nt);
-        fmpz_mat_mul(tmp, Ac, Br);
-        fmpz_mat_add(Cb, Cb, tmp); 
-        fmpz_mat_clear(tmp);
-        fmpz_mat_window_clear(Ac);
-        fmpz_mat_window_clear(Br);
-        fmpz_mat_window_clear(Cb);
+        for (i = 0; i < 2*anr; i++)
+            for (j = 0; j < 2*bnc; j++)
+                fmpz_addmul(fmpz_mat_entry(C, i, j),
+                    fmpz_mat_entry(A, i, b - 1), fmpz_mat_entry(B, b - 1, j));
     }
 }
+
+void
+_fmpz_mat_mul_strassen_cutoff(fmpz_mat_t C, const fmpz_mat_t A,
+                                        const fmpz_mat_t B, slong cutoff)
+{
+    fmpz * T;
+    slong n;
+
+    cutoff = FLINT_MAX(cutoff, 1);
+
+    n = _fmpz_mat_mul_strassen_scratch(A->r, A->c, B->c, cutoff);
+    T = _fmpz_vec_init(n);
+
+    _fmpz_mat_mul_strassen(C, A, B, T, cutoff);
+
+    _fmpz_vec_clear(T, n);
+}
+
+void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
+{
+    if (A->r <= 4 || A->c <= 4 || B->c <= 4)
+    {
+        fmpz_mat_mul(C, A, B);
+        return;
+    }
+
+    _fmpz_mat_mul_strassen_cutoff(C, A, B, FMPZ_MAT_MUL_STRASSEN_SPACE_CUTOFF);
+}
@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_mat.h"
+#include "thread_support.h"
+
+/*
+    Limits the number of workers available to the calling thread so that
+    at most thread_limit threads take part, no limit other than
+    flint_get_num_threads() being imposed if thread_limit is not positive.
+    Returns the value to pass to flint_reset_num_workers afterwards.
+*/
+int
+_fmpz_mat_set_thread_limit(slong thread_limit)
+{
+    if (thread_limit <= 0 || thread_limit > FLINT_DEFAULT_THREAD_LIMIT)
+        thread_limit = FLINT_DEFAULT_THREAD_LIMIT;
+
+    return flint_set_num_workers(thread_limit - 1);
+}
@@ -10,11 +10,117 @@
 */
 
 #include "fmpz_mat.h"
+#include "thread_support.h"
+
+/*
+    Once the multipliers of an elimination step are known, the column
+    (resp. row) operations only touch one row (resp. column) of S at a
+    time, so they are applied to blocks of rows (resp. columns) in parallel.
+*/
+typedef struct
+{
+    fmpz_mat_struct * S;
+    const fmpz * mod;
+    const fmpz * t;         /* multipliers of the gcd combination */
+    const fmpz * r;         /* multipliers of the reduction, if any */
+    slong i;
+    slong start;
+    slong len;
+    slong nblocks;
+}
+_snf_elim_arg_t;
+
+/* row i += sum t[k] row k, then row k += r[k] row i, on a block of columns */
+static void
+_eliminate_col_worker(slong b, _snf_elim_arg_t * arg)
+{
+    fmpz_mat_struct * S = arg->S;
+    slong i = arg->i, m = S->r, j, k, j0, j1;
+
+    j0 = arg->start + (b * arg->len) / arg->nblocks;
+    j1 = arg->start + ((b + 1) * arg->len) / arg->nblocks;
+
+    for (k = i + 1; k < m; k++)
+        for (j = j0; j < j1; j++)
+            fmpz_addmul(fmpz_mat_entry(S, i, j), arg->t + k - i - 1,
+                    fmpz_mat_entry(S, k, j));
+
+    if (arg->r != NULL)
+    {
+        for (k = i + 1; k < m; k++)
+            for (j = j0; j < j1; j++)
+                fmpz_addmul(fmpz_mat_entry(S, k, j), arg->r + k - i - 1,
+                        fmpz_mat_entry(S, i, j));
+
+        if (j0 == i)
+            for (k = i + 1; k < m; k++)
+                fmpz_mod(fmpz_mat_entry(S, k, i), fmpz_mat_entry(S, k, i),
+                        arg->mod);
+    }
+
+    for (j = i; j < m; j++)
+        for (k = FLINT_MAX(j0, i + 1); k < j1; k++)
+            fmpz_fdiv_r(fmpz_mat_entry(S, j, k), fmpz_mat_entry(S, j, k),
+                    arg->mod);
+}
+
+/* col i += sum t[k] col k, then col k += r[k] col i, on a block of rows */
+static void
+_eliminate_row_worker(slong b, _snf_elim_arg_t * arg)
+{
+    fmpz_mat_struct * S = arg->S;
+    slong i = arg->i, n = S->c, j, k, j0, j1;
+
+    j0 = arg->start + (b * arg->len) / arg->nblocks;
+    j1 = arg->start + ((b + 1) * arg->len) / arg->nblocks;
+
+    for (j = j0; j < j1; j++)
+    {
+        for (k = i + 1; k < n; k++)
+            fmpz_addmul(fmpz_mat_entry(S, j, i), arg->t + k - i - 1,
+                    fmpz_mat_entry(S, j, k));
+
+        if (arg->r != NULL)
+            for (k = i + 1; k < n; k++)
+                fmpz_addmul(fmpz_mat_entry(S, j, k), arg->r + k - i - 1,
+                        fmpz_mat_entry(S, j, i));
+
+        if (j > i)
+            for (k = i; k < n; k++)
+                fmpz_fdiv_r(fmpz_mat_entry(S, j, k), fmpz_mat_entry(S, j, k),
+                        arg->mod);
+    }
+}
+
+static void
+_snf_elim(do_func_t worker, fmpz_mat_t S, slong i, slong len, slong other,
+        const fmpz * t, const fmpz * r, const fmpz_t mod)
+{
+    _snf_elim_arg_t arg;
+    slong nblocks = 1;
+
+    arg.S = S;
+    arg.mod = mod;
+    arg.t = t;
+    arg.r = r;
+    arg.i = i;
+    arg.start = i;
+    arg.len = len;
+
+    if (len > 1 && len * other * fmpz_size(mod) >= FMPZ_MAT_ELIM_PARALLEL_CUTOFF)
+        nblocks = FLINT_MIN(flint_get_num_threads(), len);
+    arg.nblocks = nblocks;
+
+    if (nblocks > 1)
+        flint_parallel_do(worker, &arg, nblocks, 0, FLINT_PARALLEL_UNIFORM);
+    else
+        worker(0, &arg);
+}
 
 static void _eliminate_col(fmpz_mat_t S, slong i, const fmpz_t mod)
 {
     slong j, k, m, n;
-    fmpz * t;
+    fmpz * t, * r;
     fmpz_t b, g, u, v, r1g, r2g;
 
     m = S->r;
@@ -66,34 +172,28 @@ static void _eliminate_col(fmpz_mat_t S, slong i, const fmpz_t mod)
             fmpz_mul(t + k, t + k, u);
     }
 
-    /* set row i to have gcd in col i */
-    for (k = i + 1; k < m; k++)
-    {
-        fmpz_mod(t + k - i - 1, t + k - i - 1, mod);
-        for (j = i; j < n; j++)
-            fmpz_addmul(fmpz_mat_entry(S, i, j), t + k - i - 1,
-                    fmpz_mat_entry(S, k, j));
-    }
-
-    _fmpz_vec_clear(t, m - i - 1);
+    for (k = 0; k < m - i - 1; k++)
+        fmpz_mod(t + k, t + k, mod);
 
-    /* reduce each row k with row i */
+    /* the multipliers -S[k][i]/g are not affected by the update of row i */
+    r = NULL;
     if (!fmpz_is_zero(g)) /* if g = 0 then don't need to reduce */
     {
+        r = _fmpz_vec_init(m - i - 1);
         for (k = i + 1; k < m; k++)
         {
-            fmpz_divexact(r1g, fmpz_mat_entry(S, k, i), g);
-            fmpz_neg(r1g, r1g);
-            for (j = i; j < n; j++)
-                fmpz_addmul(fmpz_mat_entry(S, k, j), r1g,
-                        fmpz_mat_entry(S, i, j));
+            fmpz_divexact(r + k - i - 1, fmpz_mat_entry(S, k, i), g);
+            fmpz_neg(r + k - i - 1, r + k - i - 1);
         }
-        for (k = i + 1; k < m; k++)
-            fmpz_mod(fmpz_mat_entry(S, k, i), fmpz_mat_entry(S, k, i), mod);
     }
-    for (j = i; j < m; j++)
-        for (k = i + 1; k < n; k++)
-            fmpz_fdiv_r(fmpz_mat_entry(S, j, k), fmpz_mat_entry(S, j, k), mod);
+
+    /* set row i to have gcd in col i, reduce each row k with row i */
+    _snf_elim((do_func_t) _eliminate_col_worker, S, i, n - i, m - i, t, r, mod);
+
+    _fmpz_vec_clear(t, m - i - 1);
+    if (r != NULL)
+        _fmpz_vec_clear(r, m - i - 1);
+
     fmpz_gcd(fmpz_mat_entry(S, i, i), fmpz_mat_entry(S, i, i), mod);
 
     fmpz_clear(b);
@@ -106,7 +206,7 @@ static void _eliminate_col(fmpz_mat_t S, slong i, const fmpz_t mod)
 static void _eliminate_row(fmpz_mat_t S, slong i, const fmpz_t mod)
 {
     slong j, k, m, n;
-    fmpz * t;
+    fmpz * t, * r;
     fmpz_t b, g, u, v, r1g, r2g, halfmod;
 
     m = S->r;
@@ -160,32 +260,28 @@ static void _eliminate_row(fmpz_mat_t S, slong i, const fmpz_t mod)
             fmpz_mul(t + k, t + k, u);
     }
 
-    /* reduce col i to have gcd in row i */
-    for (k = i + 1; k < n; k++)
-    {
-        fmpz_mod(t + k - i - 1, t + k - i - 1, mod);
-        for (j = i; j < m; j++)
-            fmpz_addmul(fmpz_mat_entry(S, j, i), t + k - i - 1,
-                    fmpz_mat_entry(S, j, k));
-    }
+    for (k = 0; k < n - i - 1; k++)
+        fmpz_mod(t + k, t + k, mod);
 
-    _fmpz_vec_clear(t, n - i - 1);
-
-    /* reduce each col k with col i */
+    /* the multipliers -S[i][k]/g are not affected by the update of col i */
+    r = NULL;
     if (!fmpz_is_zero(g)) /* if g = 0 then don't need to reduce */
     {
+        r = _fmpz_vec_init(n - i - 1);
         for (k = i + 1; k < n; k++)
         {
-            fmpz_divexact(r1g, fmpz_mat_entry(S, i, k), g);
-            fmpz_neg(r1g, r1g);
-            for (j = i; j < m; j++)
-                fmpz_addmul(fmpz_mat_entry(S, j, k), r1g,
-                        fmpz_mat_entry(S, j, i));
+            fmpz_divexact(r + k - i - 1, fmpz_mat_entry(S, i, k), g);
+            fmpz_neg(r + k - i - 1, r + k - i - 1);
         }
     }
-    for (j = i + 1; j < m; j++)
-        for (k = i; k < n; k++)
-            fmpz_fdiv_r(fmpz_mat_entry(S, j, k), fmpz_mat_entry(S, j, k), mod);
+
+    /* reduce col i to have gcd in row i, reduce each col k with col i */
+    _snf_elim((do_func_t) _eliminate_row_worker, S, i, m - i, n - i, t, r, mod);
+
+    _fmpz_vec_clear(t, n - i - 1);
+    if (r != NULL)
+        _fmpz_vec_clear(r, n - i - 1);
+
     fmpz_gcd(fmpz_mat_entry(S, i, i), fmpz_mat_entry(S, i, i), mod);
 
     fmpz_clear(b);
@@ -87,6 +87,52 @@ mp_limb_t * fmpz_mat_dixon_get_crt_primes(slong * num_primes, const fmpz_mat_t A
 }
 
 
+/*
+    The products A y modulo the CRT primes are independent and are computed
+    in parallel; Ay is then reconstructed from them row by row, also in
+    parallel.
+*/
+typedef struct
+{
+    nmod_mat_struct * A_mod;
+    nmod_mat_struct * Ay_mod;
+    const nmod_mat_struct * y_mod;
+    fmpz_mat_struct * Ay;
+    const fmpz_comb_struct * comb;
+    slong num_primes;
+}
+_dixon_mul_arg;
+
+static void
+_dixon_mul_worker(slong i, _dixon_mul_arg * arg)
+{
+    nmod_mat_struct y = *arg->y_mod; /* shares the entries of y_mod */
+
+    _nmod_mat_set_mod(&y, arg->A_mod[i].mod.n);
+    nmod_mat_mul(arg->Ay_mod + i, arg->A_mod + i, &y);
+}
+
+static void
+_dixon_crt_worker(slong i, _dixon_mul_arg * arg)
+{
+    fmpz_comb_temp_t temp;
+    mp_ptr r;
+    slong j, k;
+
+    fmpz_comb_temp_init(temp, arg->comb);
+    r = _nmod_vec_init(arg->num_primes);
+
+    for (j = 0; j < fmpz_mat_ncols(arg->Ay); j++)
+    {
+        for (k = 0; k < arg->num_primes; k++)
+            r[k] = nmod_mat_entry(arg->Ay_mod + k, i, j);
+        fmpz_multi_CRT_ui(fmpz_mat_entry(arg->Ay, i, j), r, arg->comb, temp, 1);
+    }
+
+    _nmod_vec_clear(r);
+    fmpz_comb_temp_clear(temp);
+}
+
 void
 _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
                         const fmpz_mat_t A, const fmpz_mat_t B,
@@ -95,10 +141,11 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 {
     fmpz_t bound, ppow;
     fmpz_mat_t x, d, y, Ay;
-    fmpz_t prod;
     mp_limb_t * crt_primes;
-    nmod_mat_t * A_mod;
-    nmod_mat_t Ay_mod, d_mod, y_mod;
+    nmod_mat_struct * A_mod, * Ay_mod;
+    nmod_mat_t d_mod, y_mod;
+    fmpz_comb_t comb;
+    _dixon_mul_arg arg;
     slong i, n, cols, num_primes;
 
     n = A->r;
@@ -106,7 +153,6 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 
     fmpz_init(bound);
     fmpz_init(ppow);
-    fmpz_init(prod);
 
     fmpz_mat_init(x, n, cols);
     fmpz_mat_init(y, n, cols);
@@ -125,14 +171,24 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
     fmpz_mul_ui(bound, bound, UWORD(2));  /* signs */
 
     crt_primes = fmpz_mat_dixon_get_crt_primes(&num_primes, A, p);
-    A_mod = (nmod_mat_t *) flint_malloc(sizeof(nmod_mat_t) * num_primes);
+    A_mod = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
+    Ay_mod = flint_malloc(sizeof(nmod_mat_struct) * num_primes);
     for (i = 0; i < num_primes; i++)
     {
-        nmod_mat_init(A_mod[i], n, n, crt_primes[i]);
-        fmpz_mat_get_nmod_mat(A_mod[i], A);
+        nmod_mat_init(A_mod + i, n, n, crt_primes[i]);
+        fmpz_mat_get_nmod_mat(A_mod + i, A);
+        nmod_mat_init(Ay_mod + i, n, cols, crt_primes[i]);
     }
 
-    nmod_mat_init(Ay_mod, n, cols, UWORD(1));
+    fmpz_comb_init(comb, crt_primes, num_primes);
+
+    arg.A_mod = A_mod;
+    arg.Ay_mod = Ay_mod;
+    arg.y_mod = y_mod;
+    arg.Ay = Ay;
+    arg.comb = comb;
+    arg.num_primes = num_primes;
+
     nmod_mat_init(d_mod, n, cols, p);
     nmod_mat_init(y_mod, n, cols, p);
 
@@ -157,25 +213,12 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
         fmpz_mat_set_nmod_mat_unsigned(y, y_mod);
         fmpz_mat_mul(Ay, A, y);
 #else
-        for (i = 0; i < num_primes; i++)
-        {
-            _nmod_mat_set_mod(y_mod, crt_primes[i]);
-            _nmod_mat_set_mod(Ay_mod, crt_primes[i]);
-            nmod_mat_mul(Ay_mod, A_mod[i], y_mod);
-            if (i == 0)
-            {
-                fmpz_mat_set_nmod_mat(Ay, Ay_mod);
-                fmpz_set_ui(prod, crt_primes[0]);
-            }
-            else
-            {
-                fmpz_mat_CRT_ui(Ay, Ay, prod, Ay_mod, 1);
-                fmpz_mul_ui(prod, prod, crt_primes[i]);
-            }
-        }
+        flint_parallel_do((do_func_t) _dixon_mul_worker, &arg, num_primes,
+                                                    0, FLINT_PARALLEL_UNIFORM);
+        flint_parallel_do((do_func_t) _dixon_crt_worker, &arg, n,
+                                                    0, FLINT_PARALLEL_UNIFORM);
 #endif
 
-        _nmod_mat_set_mod(y_mod, p);
         fmpz_mat_sub(d, d, Ay);
         fmpz_mat_scalar_divexact_ui(d, d, p);
     }
@@ -185,17 +228,20 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 
     nmod_mat_clear(y_mod);
     nmod_mat_clear(d_mod);
-    nmod_mat_clear(Ay_mod);
 
     for (i = 0; i < num_primes; i++)
-        nmod_mat_clear(A_mod[i]);
+    {
+        nmod_mat_clear(A_mod + i);
+        nmod_mat_clear(Ay_mod + i);
+    }
 
     flint_free(A_mod);
+    flint_free(Ay_mod);
+    fmpz_comb_clear(comb);
     flint_free(crt_primes);
 
     fmpz_clear(bound);
     fmpz_clear(ppow);
-    fmpz_clear(prod);
 
     fmpz_mat_clear(x);
     fmpz_mat_clear(y);
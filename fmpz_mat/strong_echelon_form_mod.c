@@ -10,6 +10,7 @@
 */
 
 #include "fmpz_mat.h"
+#include "thread_support.h"
 
 static int
 _fmpz_mat_pivot(fmpz_mat_t A, slong start_row, slong col)
@@ -154,13 +155,122 @@ _fmpz_is_divisible_mod(fmpz_t q, fmpz_t b, fmpz_t a, const fmpz_t N)
     return 0;
 }
 
+/*
+    The row operations for a pivot only depend on the pivot column, so they
+    are determined first and then applied to the remaining columns, which
+    are split into blocks handled by separate threads.
+*/
+typedef struct
+{
+    fmpz_mat_struct * A;
+    const fmpz * mod;
+    slong row;
+    slong start;
+    slong len;
+    slong nblocks;
+    const slong * rows;
+    const int * divisible;
+    const fmpz * tr;        /* s or s, t, u, v for each row */
+    slong nrows;
+}
+_echelon_elim_arg_t;
+
+static void
+_echelon_elim_worker(slong b, _echelon_elim_arg_t * arg)
+{
+    fmpz_mat_struct * A = arg->A;
+    const fmpz * mod = arg->mod, * tr;
+    slong row = arg->row, i, k, l, k0, k1;
+    fmpz_t t1, t2;
+
+    k0 = arg->start + (b * arg->len) / arg->nblocks;
+    k1 = arg->start + ((b + 1) * arg->len) / arg->nblocks;
+
+    fmpz_init(t1);
+    fmpz_init(t2);
+
+    for (l = 0; l < arg->nrows; l++)
+    {
+        i = arg->rows[l];
+        tr = arg->tr + 4 * l;
+
+        if (arg->divisible[l])
+        {
+            for (k = k0; k < k1; k++)
+            {
+                fmpz_set(t1, fmpz_mat_entry(A, i, k));
+                fmpz_submul(t1, tr + 0, fmpz_mat_entry(A, row, k));
+                fmpz_mod(t1, t1, mod);
+                fmpz_set(fmpz_mat_entry(A, i, k), t1);
+            }
+        }
+        else
+        {
+            for (k = k0; k < k1; k++)
+            {
+                fmpz_mul(t1, tr + 0, fmpz_mat_entry(A, row, k));
+                fmpz_addmul(t1, tr + 1, fmpz_mat_entry(A, i, k));
+                fmpz_mod(t1, t1, mod);
+                fmpz_mul(t2, tr + 2, fmpz_mat_entry(A, row, k));
+                fmpz_addmul(t2, tr + 3, fmpz_mat_entry(A, i, k));
+                fmpz_mod(t2, t2, mod);
+                fmpz_set(fmpz_mat_entry(A, row, k), t1);
+                fmpz_set(fmpz_mat_entry(A, i, k), t2);
+            }
+        }
+    }
+
+    fmpz_clear(t1);
+    fmpz_clear(t2);
+}
+
+/* reduce the rows above row i with row i */
+typedef struct
+{
+    fmpz_mat_struct * A;
+    const fmpz * mod;
+    slong i;
+    slong len;
+    slong nblocks;
+}
+_echelon_reduce_arg_t;
+
+static void
+_echelon_reduce_worker(slong b, _echelon_reduce_arg_t * arg)
+{
+    fmpz_mat_struct * A = arg->A;
+    slong i = arg->i, m = A->c, k, l, k0, k1;
+    fmpz_t q;
+
+    k0 = (b * arg->len) / arg->nblocks;
+    k1 = ((b + 1) * arg->len) / arg->nblocks;
+
+    fmpz_init(q);
+
+    for (k = k0; k < k1; k++)
+    {
+        fmpz_fdiv_q(q, fmpz_mat_entry(A, k, i), fmpz_mat_entry(A, i, i));
+        for (l = i; l < m; l++)
+        {
+            fmpz_submul(fmpz_mat_entry(A, k, l), fmpz_mat_entry(A, i, l), q);
+            fmpz_mod(fmpz_mat_entry(A, k, l), fmpz_mat_entry(A, k, l), arg->mod);
+        }
+    }
+
+    fmpz_clear(q);
+}
+
 void
 fmpz_mat_strong_echelon_form_mod(fmpz_mat_t A, const fmpz_t mod)
 {
     fmpz_t s, t, q, u, v, t1, t2, g;
-    slong m, n, row, col, i, k, l;
+    slong m, n, row, col, i, k, l, nrows, nblocks, limbs;
     fmpz  ** r;
-    fmpz * extra_row;
+    fmpz * extra_row, * tr;
+    slong * rows;
+    int * divisible;
+    _echelon_elim_arg_t elim;
+    _echelon_reduce_arg_t red;
 
     if (fmpz_mat_is_empty(A))
         return;
@@ -179,6 +289,10 @@ fmpz_mat_strong_echelon_form_mod(fmpz_mat_t A, const fmpz_t mod)
     r = A->rows;
 
     extra_row = _fmpz_vec_init(m);
+    tr = _fmpz_vec_init(4 * n);
+    rows = (slong *) flint_malloc(n * sizeof(slong));
+    divisible = (int *) flint_malloc(n * sizeof(int));
+    limbs = fmpz_size(mod);
 
     row = col = 0;
 
@@ -199,42 +313,71 @@ fmpz_mat_strong_echelon_form_mod(fmpz_mat_t A, const fmpz_t mod)
             col++;
             continue;
         }
+        /* reduce rows i > row with row, column col first */
+        nrows = 0;
         for (i = row + 1; i < n; i++)
         {
+            fmpz * c = tr + 4 * nrows;
+
             if (fmpz_is_zero(fmpz_mat_entry(A, i, col)))
             {
                 continue;
             }
-            if ( _fmpz_is_divisible_mod(s, fmpz_mat_entry(A, i, col), fmpz_mat_entry(A, row, col), mod))
+
+            rows[nrows] = i;
+            divisible[nrows] = _fmpz_is_divisible_mod(c, fmpz_mat_entry(A, i, col), fmpz_mat_entry(A, row, col), mod);
+
+            if (divisible[nrows])
             {
-                for (k = col; k < m; k++)
-                {
-                    fmpz_set(t1, fmpz_mat_entry(A, i, k));
-                    fmpz_submul(t1, s, fmpz_mat_entry(A, row, k));
-                    fmpz_mod(t1, t1, mod);
-                    fmpz_set(fmpz_mat_entry(A, i, k), t1);
-                }
+                fmpz_set(t1, fmpz_mat_entry(A, i, col));
+                fmpz_submul(t1, c, fmpz_mat_entry(A, row, col));
+                fmpz_mod(t1, t1, mod);
+                fmpz_set(fmpz_mat_entry(A, i, col), t1);
             }
             else
             {
-                fmpz_xgcd(g, s, t, fmpz_mat_entry(A, row, col), fmpz_mat_entry(A, i, col));
-                fmpz_divexact(u, fmpz_mat_entry(A, i, col), g);
-                fmpz_neg(u, u);
-                fmpz_divexact(v, fmpz_mat_entry(A, row, col), g);
+                fmpz_xgcd(g, c + 0, c + 1, fmpz_mat_entry(A, row, col), fmpz_mat_entry(A, i, col));
+                fmpz_divexact(c + 2, fmpz_mat_entry(A, i, col), g);
+                fmpz_neg(c + 2, c + 2);
+                fmpz_divexact(c + 3, fmpz_mat_entry(A, row, col), g);
 
-                for (k = col; k < m; k++)
-                {
-                    fmpz_mul(t1, s, fmpz_mat_entry(A, row, k));
-                    fmpz_addmul(t1, t, fmpz_mat_entry(A, i, k));
-                    fmpz_mod(t1, t1, mod);
-                    fmpz_mul(t2, u, fmpz_mat_entry(A, row, k));
-                    fmpz_addmul(t2, v, fmpz_mat_entry(A, i, k));
-                    fmpz_mod(t2, t2, mod);
-                    fmpz_set(fmpz_mat_entry(A, row, k), t1);
-                    fmpz_set(fmpz_mat_entry(A, i, k), t2);
-                }
+                fmpz_mul(t1, c + 0, fmpz_mat_entry(A, row, col));
+                fmpz_addmul(t1, c + 1, fmpz_mat_entry(A, i, col));
+                fmpz_mod(t1, t1, mod);
+                fmpz_mul(t2, c + 2, fmpz_mat_entry(A, row, col));
+                fmpz_addmul(t2, c + 3, fmpz_mat_entry(A, i, col));
+                fmpz_mod(t2, t2, mod);
+                fmpz_set(fmpz_mat_entry(A, row, col), t1);
+                fmpz_set(fmpz_mat_entry(A, i, col), t2);
             }
+
+            nrows++;
         }
+
+        elim.A = A;
+        elim.mod = mod;
+        elim.row = row;
+        elim.start = col + 1;
+        elim.len = m - col - 1;
+        elim.rows = rows;
+        elim.divisible = divisible;
+        elim.tr = tr;
+        elim.nrows = nrows;
+
+        nblocks = 1;
+        if (elim.len > 1 && nrows * elim.len * limbs >= FMPZ_MAT_ELIM_PARALLEL_CUTOFF)
+            nblocks = FLINT_MIN(flint_get_num_threads(), elim.len);
+        elim.nblocks = nblocks;
+
+        if (nrows > 0 && elim.len > 0)
+        {
+            if (nblocks > 1)
+                flint_parallel_do((do_func_t) _echelon_elim_worker, &elim,
+                                           nblocks, 0, FLINT_PARALLEL_UNIFORM);
+            else
+                _echelon_elim_worker(0, &elim);
+        }
+
         for (i = row - 1; i >= 0; i--)
         {
             fmpz_mod(fmpz_mat_entry(A, i, col), fmpz_mat_entry(A, i, col), mod);
@@ -317,19 +460,28 @@ fmpz_mat_strong_echelon_form_mod(fmpz_mat_t A, const fmpz_t mod)
     {
         if (!fmpz_is_zero(fmpz_mat_entry(A, i, i)))
         {
-            for (k = i - 1; k >= 0; k--)
-            {
-                fmpz_fdiv_q(q, fmpz_mat_entry(A, k, i), fmpz_mat_entry(A, i, i));
-                for (l = i; l < m; l++)
-                {
-                    fmpz_submul(fmpz_mat_entry(A, k, l), fmpz_mat_entry(A, i, l), q);
-                    fmpz_mod(fmpz_mat_entry(A, k, l), fmpz_mat_entry(A, k, l), mod);
-                }
-            }
+            red.A = A;
+            red.mod = mod;
+            red.i = i;
+            red.len = i;
+
+            nblocks = 1;
+            if (i > 1 && i * (m - i) * limbs >= FMPZ_MAT_ELIM_PARALLEL_CUTOFF)
+                nblocks = FLINT_MIN(flint_get_num_threads(), i);
+            red.nblocks = nblocks;
+
+            if (nblocks > 1)
+                flint_parallel_do((do_func_t) _echelon_reduce_worker, &red,
+                                           nblocks, 0, FLINT_PARALLEL_UNIFORM);
+            else
+                _echelon_reduce_worker(0, &red);
         }
     }
 
     _fmpz_vec_clear(extra_row, m);
+    _fmpz_vec_clear(tr, 4 * n);
+    flint_free(rows);
+    flint_free(divisible);
     fmpz_clear(s);
     fmpz_clear(t);
     fmpz_clear(q);
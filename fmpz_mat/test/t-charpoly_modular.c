@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong m, rep;
+    slong max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("charpoly_modular....");
+    fflush(stdout);
+
+    for (rep = 0; rep < 200 * flint_test_multiplier(); rep++)
+    {
+        fmpz_mat_t A;
+        fmpz_poly_t f, g;
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        m = n_randint(state, 15);
+
+        fmpz_mat_init(A, m, m);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+
+        fmpz_mat_randtest(A, state, 1 + n_randint(state, 100));
+
+        fmpz_mat_charpoly_berkowitz(f, A);
+        fmpz_mat_charpoly_modular(g, A);
+
+        if (!fmpz_poly_equal(f, g))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("Matrix A:\n"), fmpz_mat_print(A), flint_printf("\n");
+            flint_printf("berkowitz = "), fmpz_poly_print_pretty(f, "X"), flint_printf("\n");
+            flint_printf("modular = "), fmpz_poly_print_pretty(g, "X"), flint_printf("\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -26,6 +26,7 @@ main(void)
     slong i, m;
 
     fmpz_t det1, det2;
+    slong max_threads = 5;
 
     FLINT_TEST_INIT(state);
 
@@ -37,6 +38,8 @@ main(void)
         int proved = n_randlimb(state) % 2;
         m = n_randint(state, 10);
 
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         fmpz_mat_init(A, m, m);
 
         fmpz_init(det1);
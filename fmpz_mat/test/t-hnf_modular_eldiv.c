@@ -20,6 +20,7 @@ int
 main(void)
 {
     slong iter;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("hnf_modular_eldiv....");
@@ -118,6 +119,52 @@ main(void)
         fmpz_clear(det);
     }
 
+    /* larger matrices, threaded */
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        fmpz_t det;
+        fmpz_mat_t A, H, H2;
+        slong n, b;
+
+        n = 20 + n_randint(state, 20);
+
+        fmpz_init(det);
+        fmpz_mat_init(A, n, n);
+        fmpz_mat_init(H, n, n);
+        fmpz_mat_init(H2, n, n);
+
+        b = 1 + n_randint(state, 100);
+        fmpz_mat_randrank(A, state, n, b);
+        fmpz_mat_randops(A, state, n_randint(state, 2*n*n + 1));
+
+        fmpz_mat_det(det, A);
+        fmpz_abs(det, det);
+        fmpz_mul_ui(det, det, 1 + n_randint(state, 10));
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        fmpz_mat_set(H, A);
+        fmpz_mat_hnf_modular_eldiv_threaded(H, det,
+                                           n_randint(state, max_threads + 1));
+        fmpz_mat_set(H2, A);
+        fmpz_mat_hnf_modular_eldiv_threaded(H2, det, 1);
+
+        if (!fmpz_mat_is_in_hnf(H) || !fmpz_mat_equal(H, H2))
+        {
+            flint_printf("FAIL (threaded):\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H2); flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_clear(H2);
+        fmpz_mat_clear(H);
+        fmpz_mat_clear(A);
+        fmpz_clear(det);
+    }
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
@@ -20,6 +20,7 @@ int
 main(void)
 {
     slong iter;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("hnf_pernet_stein....");
@@ -160,6 +161,43 @@ main(void)
         fmpz_mat_clear(A);
     }
 
+    /* larger matrices, threaded */
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, H, H2;
+        slong m, n, b;
+
+        n = 20 + n_randint(state, 40);
+        m = n + n_randint(state, 10);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(H, m, n);
+        fmpz_mat_init(H2, m, n);
+
+        b = 1 + n_randint(state, 200);
+        fmpz_mat_randtest(A, state, b);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        fmpz_mat_hnf_pernet_stein_threaded(H, A, state,
+                                           n_randint(state, max_threads + 1));
+        fmpz_mat_hnf_pernet_stein_threaded(H2, A, state, 1);
+
+        if (!fmpz_mat_is_in_hnf(H) || !fmpz_mat_equal(H, H2))
+        {
+            flint_printf("FAIL (threaded):\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H); flint_printf("\n\n");
+            fmpz_mat_print_pretty(H2); flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_clear(H2);
+        fmpz_mat_clear(H);
+        fmpz_mat_clear(A);
+    }
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
@@ -22,6 +22,7 @@ int main(void)
 {
     fmpz_mat_t A, B, C, D;
     slong i;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("mul_multi_mod....");
@@ -30,18 +31,24 @@ int main(void)
     for (i = 0; i < 100 * flint_test_multiplier(); i++)
     {
         slong m, n, k;
+        flint_bitcnt_t bits;
 
         m = n_randint(state, 50);
         n = n_randint(state, 50);
         k = n_randint(state, 50);
 
+        /* occasionally enough primes to use a comb */
+        bits = (n_randint(state, 20) == 0) ? 7000 : 200;
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         fmpz_mat_init(A, m, n);
         fmpz_mat_init(B, n, k);
         fmpz_mat_init(C, m, k);
         fmpz_mat_init(D, m, k);
 
-        fmpz_mat_randtest(A, state, n_randint(state, 200) + 1);
-        fmpz_mat_randtest(B, state, n_randint(state, 200) + 1);
+        fmpz_mat_randtest(A, state, n_randint(state, bits) + 1);
+        fmpz_mat_randtest(B, state, n_randint(state, bits) + 1);
 
         /* Make sure noise in the output is ok */
         fmpz_mat_randtest(C, state, n_randint(state, 200) + 1);
@@ -97,6 +104,47 @@ int main(void)
         fmpz_mat_clear(D);
     }
 
+    /* inputs much larger than the given output bound */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t t;
+        flint_bitcnt_t big = 64 + n_randint(state, 3000);
+        slong r = 1 + n_randint(state, 100);
+
+        fmpz_init(t);
+
+        fmpz_mat_init(A, 1, 2);
+        fmpz_mat_init(B, 2, 1);
+        fmpz_mat_init(C, 1, 1);
+        fmpz_mat_init(D, 1, 1);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        /* (2^big + r)*1 + 2^big*(-1) = r */
+        fmpz_one(t);
+        fmpz_mul_2exp(t, t, big);
+        fmpz_add_ui(fmpz_mat_entry(A, 0, 0), t, r);
+        fmpz_set(fmpz_mat_entry(A, 0, 1), t);
+        fmpz_one(fmpz_mat_entry(B, 0, 0));
+        fmpz_set_si(fmpz_mat_entry(B, 1, 0), -1);
+
+        fmpz_set_si(fmpz_mat_entry(C, 0, 0), r);
+        _fmpz_mat_mul_multi_mod(D, A, B, 1, FLINT_BIT_COUNT(r));
+
+        if (!fmpz_mat_equal(C, D))
+        {
+            flint_printf("FAIL: tight output bound\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_clear(t);
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(D);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
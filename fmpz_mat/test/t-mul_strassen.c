@@ -64,6 +64,44 @@ main(void)
         fmpz_mat_clear(D);
     }
 
+    /* several levels of recursion at small, mostly odd, sizes */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        fmpz_mat_t A, B, C, D;
+        slong m, k, n, cutoff;
+
+        m = 2*n_randint(state, 25) + n_randint(state, 4);
+        k = 2*n_randint(state, 25) + n_randint(state, 4);
+        n = 2*n_randint(state, 25) + n_randint(state, 4);
+        cutoff = n_randint(state, 6);
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, n, k);
+        fmpz_mat_init(C, m, k);
+        fmpz_mat_init(D, m, k);
+
+        fmpz_mat_randtest(A, state, n_randint(state, 200) + 1);
+        fmpz_mat_randtest(B, state, n_randint(state, 200) + 1);
+        fmpz_mat_randtest(D, state, n_randint(state, 200) + 1);
+
+        fmpz_mat_mul_classical(C, A, B);
+        _fmpz_mat_mul_strassen_cutoff(D, A, B, cutoff);
+
+        if (!fmpz_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal (cutoff)\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, cutoff = %wd\n",
+                                                            m, k, n, cutoff);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(D);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -20,6 +20,7 @@ int
 main(void)
 {
     slong iter;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("snf_iliopoulos....");
@@ -98,6 +99,49 @@ main(void)
         fmpz_clear(mod);
     }
 
+    /* larger matrices, threaded */
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        fmpz_mat_t A, S, S2;
+        fmpz_t mod;
+        slong m, b;
+
+        m = 20 + n_randint(state, 20);
+
+        fmpz_init(mod);
+        fmpz_mat_init(A, m, m);
+        fmpz_mat_init(S, m, m);
+        fmpz_mat_init(S2, m, m);
+
+        b = 1 + n_randint(state, 100);
+        fmpz_mat_randrank(A, state, m, b);
+        fmpz_mat_randops(A, state, n_randint(state, 2*m*m + 1));
+
+        fmpz_mat_det(mod, A);
+        fmpz_abs(mod, mod);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        fmpz_mat_snf_iliopoulos_threaded(S, A, mod,
+                                           n_randint(state, max_threads + 1));
+        fmpz_mat_snf_iliopoulos_threaded(S2, A, mod, 1);
+
+        if (!fmpz_mat_is_in_snf(S) || !fmpz_mat_equal(S, S2))
+        {
+            flint_printf("FAIL (threaded):\n");
+            fmpz_mat_print_pretty(A); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S); flint_printf("\n\n");
+            fmpz_mat_print_pretty(S2); flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_mat_clear(S2);
+        fmpz_mat_clear(S);
+        fmpz_mat_clear(A);
+        fmpz_clear(mod);
+    }
+
     FLINT_TEST_CLEANUP(state);
 
     flint_printf("PASS\n");
@@ -24,6 +24,7 @@ main(void)
     fmpz_mat_t A, X, B, AX, AXm, Bm;
     fmpz_t mod;
     slong i, m, n, r;
+    slong max_threads = 5;
     int success;
 
     FLINT_TEST_INIT(state);
@@ -36,6 +37,8 @@ main(void)
         m = n_randint(state, 20);
         n = n_randint(state, 20);
 
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         fmpz_mat_init(A, m, m);
         fmpz_mat_init(B, m, n);
         fmpz_mat_init(Bm, m, n);
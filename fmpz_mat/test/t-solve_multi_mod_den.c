@@ -26,6 +26,7 @@ main(void)
     fmpz_t den;
     slong i, m, n, r;
     int success;
+    slong max_threads = 5;
 
     FLINT_TEST_INIT(state);
 
@@ -34,6 +35,8 @@ main(void)
 
     for (i = 0; i < 100 * flint_test_multiplier(); i++)
     {
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         m = n_randint(state, 20);
         n = n_randint(state, 20);
 
@@ -657,6 +657,10 @@ FLINT_DLL void fmpz_mod_mpoly_evaluate_all_fmpz(fmpz_t eval,
                             const fmpz_mod_mpoly_t A, fmpz * const * alphas,
                                                const fmpz_mod_mpoly_ctx_t ctx);
 
+FLINT_DLL void fmpz_mod_mpoly_evaluate_all_fmpz_vec(fmpz * evs,
+                    const fmpz_mod_mpoly_t A, const fmpz * vals, slong npoints,
+                                               const fmpz_mod_mpoly_ctx_t ctx);
+
 FLINT_DLL void fmpz_mod_mpoly_evaluate_one_fmpz(fmpz_mod_mpoly_t A,
                         const fmpz_mod_mpoly_t B, slong var, const fmpz_t val,
                                                const fmpz_mod_mpoly_ctx_t ctx);
@@ -0,0 +1,185 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_mod_mpoly.h"
+#include "thread_support.h"
+
+typedef struct
+{
+    fmpz * evs;
+    const fmpz * Acoeffs;
+    const fmpz * alphas;
+    slong npoints;
+    const mpoly_eval_plan_struct * P;
+    const fmpz_mod_ctx_struct * fctx;
+    slong num_chunks;
+}
+_eval_vec_arg_t;
+
+/* ev = A(alphas) with the alphas reduced mod fctx, pw is scratch */
+static void _eval_point(fmpz_t ev, const fmpz * Acoeffs, const fmpz * alphas,
+                        const mpoly_eval_plan_struct * P, fmpz * pw,
+                        fmpz_t m, const fmpz_mod_ctx_t fctx)
+{
+    slong i, j, k;
+    slong nvars = P->nvars;
+    const slong * idx;
+    ulong prev;
+
+    for (j = 0; j < nvars; j++)
+    {
+        fmpz_one(m);
+        prev = 0;
+        for (k = P->starts[j]; k < P->starts[j + 1]; k++)
+        {
+            if (P->exps[k] - prev == 1)
+            {
+                fmpz_mod_mul(m, m, alphas + j, fctx);
+            }
+            else if (P->exps[k] != prev)
+            {
+                fmpz_mod_pow_ui(pw + k, alphas + j, P->exps[k] - prev, fctx);
+                fmpz_mod_mul(m, m, pw + k, fctx);
+            }
+            prev = P->exps[k];
+            fmpz_set(pw + k, m);
+        }
+    }
+
+    fmpz_zero(ev);
+    for (i = 0; i < P->length; i++)
+    {
+        idx = P->idx + nvars*i;
+
+        if (nvars < 1)
+        {
+            fmpz_add(ev, ev, Acoeffs + i);
+            continue;
+        }
+
+        fmpz_set(m, pw + idx[0]);
+        for (j = 1; j < nvars; j++)
+            fmpz_mod_mul(m, m, pw + idx[j], fctx);
+
+        fmpz_addmul(ev, Acoeffs + i, m);
+    }
+
+    fmpz_mod_set_fmpz(ev, ev, fctx);
+}
+
+static void _eval_vec_worker(slong c, _eval_vec_arg_t * arg)
+{
+    slong p, j, start, stop;
+    slong nvars = arg->P->nvars;
+    slong npw = arg->P->starts[nvars];
+    fmpz * pw, * t;
+    fmpz_t m;
+
+    start = (c*arg->npoints)/arg->num_chunks;
+    stop = ((c + 1)*arg->npoints)/arg->num_chunks;
+
+    pw = _fmpz_vec_init(npw);
+    t = _fmpz_vec_init(nvars);
+    fmpz_init(m);
+
+    for (p = start; p < stop; p++)
+    {
+        for (j = 0; j < nvars; j++)
+            fmpz_mod_set_fmpz(t + j, arg->alphas + nvars*p + j, arg->fctx);
+
+        _eval_point(arg->evs + p, arg->Acoeffs, t, arg->P, pw, m, arg->fctx);
+    }
+
+    _fmpz_vec_clear(pw, npw);
+    _fmpz_vec_clear(t, nvars);
+    fmpz_clear(m);
+}
+
+/* evs[p] = A(vals + nvars*p) for 0 <= p < npoints */
+void fmpz_mod_mpoly_evaluate_all_fmpz_vec(fmpz * evs,
+                    const fmpz_mod_mpoly_t A, const fmpz * vals, slong npoints,
+                                                const fmpz_mod_mpoly_ctx_t ctx)
+{
+    slong i, p, nvars = ctx->minfo->nvars;
+    const fmpz_mod_ctx_struct * fctx = ctx->ffinfo;
+    mpoly_eval_plan_t P;
+    _eval_vec_arg_t arg;
+
+    if (npoints < 1)
+        return;
+
+    if (fmpz_mod_mpoly_is_zero(A, ctx))
+    {
+        _fmpz_vec_zero(evs, npoints);
+        return;
+    }
+
+    if (fmpz_abs_fits_ui(fmpz_mod_ctx_modulus(fctx)))
+    {
+        nmod_t mod = fctx->mod;
+        mp_limb_t * c, * a, * e;
+
+        c = (mp_limb_t *) flint_malloc(A->length*sizeof(mp_limb_t));
+        a = (mp_limb_t *) flint_malloc((nvars*npoints + 1)*sizeof(mp_limb_t));
+        e = (mp_limb_t *) flint_malloc(npoints*sizeof(mp_limb_t));
+
+        for (i = 0; i < A->length; i++)
+            c[i] = fmpz_get_ui(A->coeffs + i);
+
+        for (i = 0; i < nvars*npoints; i++)
+            a[i] = fmpz_fdiv_ui(vals + i, mod.n);
+
+        _nmod_mpoly_eval_all_ui_vec(e, c, A->exps, A->length, A->bits,
+                                                a, npoints, ctx->minfo, mod);
+        for (p = 0; p < npoints; p++)
+            fmpz_set_ui(evs + p, e[p]);
+
+        flint_free(c);
+        flint_free(a);
+        flint_free(e);
+
+        return;
+    }
+
+    if (A->bits > FLINT_BITS)
+    {
+        fmpz * t = _fmpz_vec_init(nvars);
+
+        for (p = 0; p < npoints; p++)
+        {
+            for (i = 0; i < nvars; i++)
+                fmpz_mod_set_fmpz(t + i, vals + nvars*p + i, fctx);
+
+            _fmpz_mod_mpoly_eval_all_fmpz_mod(evs + p, A->coeffs, A->exps,
+                                A->length, A->bits, t, ctx->minfo, fctx);
+        }
+
+        _fmpz_vec_clear(t, nvars);
+
+        return;
+    }
+
+    mpoly_eval_plan_init(P, A->exps, A->length, A->bits, ctx->minfo);
+
+    arg.evs = evs;
+    arg.Acoeffs = A->coeffs;
+    arg.alphas = vals;
+    arg.npoints = npoints;
+    arg.P = P;
+    arg.fctx = fctx;
+    arg.num_chunks = FLINT_MIN(flint_get_num_threads(), npoints);
+
+    flint_parallel_do((do_func_t) _eval_vec_worker, &arg, arg.num_chunks, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+
+    mpoly_eval_plan_clear(P);
+}
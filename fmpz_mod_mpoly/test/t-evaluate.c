@@ -18,6 +18,7 @@ main(void)
 {
     slong i, j, v;
     int tmul = 20;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("evaluate....");
@@ -242,6 +243,64 @@ main(void)
         fmpz_mod_mpoly_ctx_clear(ctx);
     }
 
+    /* Check evalall_vec matches evalall */
+    for (i = 0; i < tmul * flint_test_multiplier(); i++)
+    {
+        fmpz_mod_mpoly_ctx_t ctx;
+        fmpz_mod_mpoly_t f;
+        fmpz_t fe;
+        fmpz * vals, * evs;
+        fmpz ** pt;
+        slong p, nvars, len, npoints;
+        flint_bitcnt_t exp_bits;
+
+        fmpz_mod_mpoly_ctx_init_rand_bits(ctx, state, 10, 200);
+        nvars = ctx->minfo->nvars;
+
+        fmpz_mod_mpoly_init(f, ctx);
+        fmpz_init(fe);
+
+        len = n_randint(state, 100);
+        exp_bits = n_randint(state, 2) ? n_randint(state, 10) + 1 :
+                                         n_randint(state, 200) + 1;
+        npoints = n_randint(state, 30);
+
+        vals = _fmpz_vec_init(nvars*npoints);
+        evs = _fmpz_vec_init(npoints);
+        pt = FLINT_ARRAY_ALLOC(nvars + 1, fmpz *);
+        for (v = 0; v < nvars*npoints; v++)
+            fmpz_randtest(vals + v, state, 200);
+
+        fmpz_mod_mpoly_randtest_bits(f, state, len, exp_bits, ctx);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+        fmpz_mod_mpoly_evaluate_all_fmpz_vec(evs, f, vals, npoints, ctx);
+
+        for (p = 0; p < npoints; p++)
+        {
+            for (v = 0; v < nvars; v++)
+                pt[v] = vals + nvars*p + v;
+
+            fmpz_mod_mpoly_evaluate_all_fmpz(fe, f, pt, ctx);
+
+            if (!fmpz_equal(evs + p, fe))
+            {
+                printf("FAIL\n");
+                flint_printf("Check evalall_vec matches evalall\ni: %wd  p: %wd\n", i, p);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        _fmpz_vec_clear(vals, nvars*npoints);
+        _fmpz_vec_clear(evs, npoints);
+        flint_free(pt);
+
+        fmpz_clear(fe);
+        fmpz_mod_mpoly_clear(f, ctx);
+        fmpz_mod_mpoly_ctx_clear(ctx);
+    }
+
     flint_printf("PASS\n");
     FLINT_TEST_CLEANUP(state);
 
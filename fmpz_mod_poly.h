@@ -39,6 +39,7 @@
 
 #define FMPZ_MOD_POLY_HGCD_CUTOFF  128      /* HGCD: Basecase -> Recursion      */
 #define FMPZ_MOD_POLY_GCD_CUTOFF  256       /* GCD:  Euclidean -> HGCD          */
+#define FMPZ_MOD_POLY_HGCD_PARALLEL_CUTOFF 128 /* HGCD: products on two threads */
 
 #define FMPZ_MOD_POLY_INV_NEWTON_CUTOFF  64 /* Inv series newton: Basecase -> Newton */
 #define FMPZ_MOD_POLY_DIV_DIVCONQUER_CUTOFF 
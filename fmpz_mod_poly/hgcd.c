@@ -16,6 +16,7 @@
 #include "flint.h"
 #include "fmpz_vec.h"
 #include "fmpz_mod_poly.h"
+#include "thread_support.h"
 
 /*
     We define a whole bunch of macros here which essentially provide 
@@ -225,6 +226,71 @@ static void __mat_mul(fmpz **C, slong *lenC,
     }
 }
 
+typedef struct
+{
+    fmpz * C;
+    slong lenC;
+    const fmpz * A;
+    slong lenA;
+    const fmpz * B;
+    slong lenB;
+    const fmpz * mod;
+}
+_mul_pair_arg_t;
+
+static void _mul_pair_worker(slong i, _mul_pair_arg_t * arg)
+{
+    const fmpz * mod = arg[i].mod;
+
+    __mul(arg[i].C, arg[i].lenC, arg[i].A, arg[i].lenA, arg[i].B, arg[i].lenB);
+}
+
+/*
+    Sets C0 to A0 B0 and C1 to A1 B1. The two products are computed on 
+    separate threads when both are large enough.
+
+    Does not support aliasing.
+ */
+
+static void __mul_pair(fmpz *C0, slong *lenC0, 
+    const fmpz *A0, slong lenA0, const fmpz *B0, slong lenB0, 
+    fmpz *C1, slong *lenC1, 
+    const fmpz *A1, slong lenA1, const fmpz *B1, slong lenB1, 
+    const fmpz_t mod)
+{
+    if (FLINT_MIN(lenA0, lenB0) < FMPZ_MOD_POLY_HGCD_PARALLEL_CUTOFF ||
+        FLINT_MIN(lenA1, lenB1) < FMPZ_MOD_POLY_HGCD_PARALLEL_CUTOFF ||
+        flint_get_num_threads() == 1)
+    {
+        __mul(C0, *lenC0, A0, lenA0, B0, lenB0);
+        __mul(C1, *lenC1, A1, lenA1, B1, lenB1);
+    }
+    else
+    {
+        _mul_pair_arg_t args[2];
+
+        args[0].C = C0;
+        args[0].A = A0;
+        args[0].lenA = lenA0;
+        args[0].B = B0;
+        args[0].lenB = lenB0;
+        args[0].mod = mod;
+
+        args[1].C = C1;
+        args[1].A = A1;
+        args[1].lenA = lenA1;
+        args[1].B = B1;
+        args[1].lenB = lenB1;
+        args[1].mod = mod;
+
+        flint_parallel_do((do_func_t) _mul_pair_worker, args, 2, 0,
+                                                      FLINT_PARALLEL_UNIFORM);
+
+        *lenC0 = args[0].lenC;
+        *lenC1 = args[1].lenC;
+    }
+}
+
 /*
     HGCD Iterative step.
 
@@ -422,8 +488,8 @@ slong _fmpz_mod_poly_hgcd_recursive(fmpz **M, slong *lenM,
         __attach_truncate(s, lens, (fmpz *) a, lena, m);
         __attach_truncate(t, lent, (fmpz *) b, lenb, m);
 
-        __mul(b2, lenb2, R[2], lenR[2], s, lens);
-        __mul(T0, lenT0, R[0], lenR[0], t, lent);
+        __mul_pair(b2, &lenb2, R[2], lenR[2], s, lens, 
+                   T0, &lenT0, R[0], lenR[0], t, lent, mod);
 
         if (sgnR < 0)
             __sub(b2, lenb2, b2, lenb2, T0, lenT0);
@@ -437,8 +503,8 @@ slong _fmpz_mod_poly_hgcd_recursive(fmpz **M, slong *lenM,
         lenb2 = FLINT_MAX(m + lenb3, lenb2);
         FMPZ_VEC_NORM(b2, lenb2);
 
-        __mul(a2, lena2, R[3], lenR[3], s, lens);
-        __mul(T0, lenT0, R[1], lenR[1], t, lent);
+        __mul_pair(a2, &lena2, R[3], lenR[3], s, lens, 
+                   T0, &lenT0, R[1], lenR[1], t, lent, mod);
 
         if (sgnR < 0)
             __sub(a2, lena2, T0, lenT0, a2, lena2);
@@ -555,8 +621,8 @@ slong _fmpz_mod_poly_hgcd_recursive(fmpz **M, slong *lenM,
             __attach_truncate(s, lens, b2, lenb2, k);
             __attach_truncate(t, lent, d, lend, k);
 
-            __mul(B, *lenB, S[2], lenS[2], s, lens);
-            __mul(T0, lenT0, S[0], lenS[0], t, lent);
+            __mul_pair(B, lenB, S[2], lenS[2], s, lens, 
+                       T0, &lenT0, S[0], lenS[0], t, lent, mod);
 
             if (sgnS < 0)
                 __sub(B, *lenB, B, *lenB, T0, lenT0);
@@ -569,8 +635,8 @@ slong _fmpz_mod_poly_hgcd_recursive(fmpz **M, slong *lenM,
             *lenB = FLINT_MAX(k + lenb3, *lenB);
             FMPZ_VEC_NORM(B, *lenB);
 
-            __mul(A, *lenA, S[3], lenS[3], s, lens);
-            __mul(T0, lenT0, S[1], lenS[1], t, lent);
+            __mul_pair(A, lenA, S[3], lenS[3], s, lens, 
+                       T0, &lenT0, S[1], lenS[1], t, lent, mod);
 
             if (sgnS < 0)
                 __sub(A, *lenA, T0, lenT0, A, *lenA);
@@ -21,6 +21,7 @@ int
 main(void)
 {
     int i, result;
+    slong max_threads = 5;
     fmpz_mod_ctx_t ctx;
     FLINT_TEST_INIT(state);
 
@@ -36,6 +37,9 @@ main(void)
     {
         fmpz_t p;
         fmpz_mod_poly_t a, b, d, g, s, t, v, w;
+        slong len;
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
 
         fmpz_init(p);
         fmpz_set_ui(p, n_randtest_prime(state, 0));
@@ -49,8 +53,12 @@ main(void)
         fmpz_mod_poly_init(t, ctx);
         fmpz_mod_poly_init(v, ctx);
         fmpz_mod_poly_init(w, ctx);
-        fmpz_mod_poly_randtest(a, state, n_randint(state, 300), ctx);
-        fmpz_mod_poly_randtest(b, state, n_randint(state, 300), ctx);
+
+        /* long enough for the threaded products in some cases */
+        len = (n_randint(state, 10) == 0) ? 2000 : 300;
+
+        fmpz_mod_poly_randtest(a, state, n_randint(state, len), ctx);
+        fmpz_mod_poly_randtest(b, state, n_randint(state, len), ctx);
 
         fmpz_mod_poly_gcd_hgcd(d, a, b, ctx);
         fmpz_mod_poly_xgcd_hgcd(g, s, t, a, b, ctx);
@@ -1220,6 +1220,47 @@ FLINT_DLL void fmpz_mpoly_height(fmpz_t max,
 FLINT_DLL void fmpz_mpoly_heights(fmpz_t max, fmpz_t sum,
                              const fmpz_mpoly_t A, const fmpz_mpoly_ctx_t ctx);
 
+/* builders ******************************************************************/
+
+#define FMPZ_MPOLY_BUILDER_CHUNK 4096
+
+/*
+    the chunks of a lane hold up to FMPZ_MPOLY_BUILDER_CHUNK unsorted terms,
+    each chunk packed with its own number of bits
+*/
+typedef struct
+{
+    fmpz_mpoly_struct * chunks;
+    slong length;
+    slong alloc;
+} fmpz_mpoly_builder_lane_struct;
+
+typedef struct
+{
+    fmpz_mpoly_builder_lane_struct * lanes;
+    slong num_lanes;
+} fmpz_mpoly_builder_struct;
+
+typedef fmpz_mpoly_builder_struct fmpz_mpoly_builder_t[1];
+
+FLINT_DLL void fmpz_mpoly_builder_init(fmpz_mpoly_builder_t B,
+                                slong num_lanes, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_clear(fmpz_mpoly_builder_t B,
+                                                   const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_push_term_fmpz_ui(fmpz_mpoly_builder_t B,
+     slong lane, const fmpz_t c, const ulong * exp, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_push_term_ui_ui(fmpz_mpoly_builder_t B,
+            slong lane, ulong c, const ulong * exp, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_push_term_si_ui(fmpz_mpoly_builder_t B,
+            slong lane, slong c, const ulong * exp, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_get_fmpz_mpoly(fmpz_mpoly_t A,
+                          fmpz_mpoly_builder_t B, const fmpz_mpoly_ctx_t ctx);
+
 /* geobuckets ****************************************************************/
 
 typedef struct fmpz_mpoly_geobucket
@@ -0,0 +1,442 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_support.h"
+#include "fmpz_mpoly.h"
+
+/* number of high bits of the exponents used to split the terms into buckets */
+#define BUILDER_DIGIT_BITS 8
+
+void fmpz_mpoly_builder_init(fmpz_mpoly_builder_t B, slong num_lanes,
+                                                    const fmpz_mpoly_ctx_t ctx)
+{
+    slong i;
+
+    FLINT_ASSERT(num_lanes > 0);
+
+    B->num_lanes = num_lanes;
+    B->lanes = FLINT_ARRAY_ALLOC(num_lanes, fmpz_mpoly_builder_lane_struct);
+    for (i = 0; i < num_lanes; i++)
+    {
+        B->lanes[i].chunks = NULL;
+        B->lanes[i].length = 0;
+        B->lanes[i].alloc = 0;
+    }
+}
+
+void fmpz_mpoly_builder_clear(fmpz_mpoly_builder_t B,
+                                                    const fmpz_mpoly_ctx_t ctx)
+{
+    slong i, j;
+
+    for (i = 0; i < B->num_lanes; i++)
+    {
+        for (j = 0; j < B->lanes[i].alloc; j++)
+            fmpz_mpoly_clear(B->lanes[i].chunks + j, ctx);
+        flint_free(B->lanes[i].chunks);
+    }
+
+    flint_free(B->lanes);
+}
+
+/* return a chunk of lane with room for a term needing exp_bits */
+static fmpz_mpoly_struct * _lane_fit_chunk(
+    fmpz_mpoly_builder_lane_struct * L,
+    flint_bitcnt_t exp_bits,
+    const fmpz_mpoly_ctx_t ctx)
+{
+    slong i;
+    fmpz_mpoly_struct * C;
+
+    if (L->length > 0)
+    {
+        C = L->chunks + L->length - 1;
+        if (C->length < FMPZ_MPOLY_BUILDER_CHUNK && exp_bits <= C->bits)
+            return C;
+
+        /* the bits only grow so that later terms seldom need a new chunk */
+        exp_bits = FLINT_MAX(exp_bits, C->bits);
+    }
+
+    if (L->length >= L->alloc)
+    {
+        slong new_alloc = FLINT_MAX(L->length + 1, 2*L->alloc);
+        L->chunks = (fmpz_mpoly_struct *) flint_realloc(L->chunks,
+                                         new_alloc*sizeof(fmpz_mpoly_struct));
+        for (i = L->alloc; i < new_alloc; i++)
+            fmpz_mpoly_init(L->chunks + i, ctx);
+        L->alloc = new_alloc;
+    }
+
+    C = L->chunks + L->length;
+    L->length++;
+
+    fmpz_mpoly_fit_length_reset_bits(C, FMPZ_MPOLY_BUILDER_CHUNK,
+                                                                exp_bits, ctx);
+    C->length = 0;
+
+    return C;
+}
+
+static fmpz * _builder_push_exp_ui(fmpz_mpoly_builder_t B, slong lane,
+                                 const ulong * exp, const fmpz_mpoly_ctx_t ctx)
+{
+    slong N;
+    flint_bitcnt_t exp_bits;
+    fmpz_mpoly_struct * C;
+
+    FLINT_ASSERT(0 <= lane && lane < B->num_lanes);
+
+    exp_bits = mpoly_exp_bits_required_ui(exp, ctx->minfo);
+    exp_bits = mpoly_fix_bits(exp_bits, ctx->minfo);
+
+    C = _lane_fit_chunk(B->lanes + lane, exp_bits, ctx);
+
+    N = mpoly_words_per_exp(C->bits, ctx->minfo);
+    mpoly_set_monomial_ui(C->exps + N*C->length, exp, C->bits, ctx->minfo);
+    C->length++;
+
+    return C->coeffs + C->length - 1;
+}
+
+void fmpz_mpoly_builder_push_term_fmpz_ui(fmpz_mpoly_builder_t B, slong lane,
+                 const fmpz_t c, const ulong * exp, const fmpz_mpoly_ctx_t ctx)
+{
+    fmpz_set(_builder_push_exp_ui(B, lane, exp, ctx), c);
+}
+
+void fmpz_mpoly_builder_push_term_ui_ui(fmpz_mpoly_builder_t B, slong lane,
+                        ulong c, const ulong * exp, const fmpz_mpoly_ctx_t ctx)
+{
+    fmpz_set_ui(_builder_push_exp_ui(B, lane, exp, ctx), c);
+}
+
+void fmpz_mpoly_builder_push_term_si_ui(fmpz_mpoly_builder_t B, slong lane,
+                        slong c, const ulong * exp, const fmpz_mpoly_ctx_t ctx)
+{
+    fmpz_set_si(_builder_push_exp_ui(B, lane, exp, ctx), c);
+}
+
+/*
+    sort the range [left, right) of A given that the bits above pos agree,
+    then combine like terms and return the number of terms left at the
+    start of the range
+*/
+static slong _sort_combine_range(fmpz_mpoly_t A, slong left, slong right,
+                  slong pos, slong N, const ulong * cmpmask, ulong totalmask)
+{
+    slong in, out;
+    fmpz * Acoeffs;
+    ulong * Aexps;
+
+    if (pos >= 0)
+    {
+        if (N == 1)
+            _fmpz_mpoly_radix_sort1(A, left, right, pos, cmpmask[0], totalmask);
+        else
+            _fmpz_mpoly_radix_sort(A, left, right, pos, N, (ulong *) cmpmask);
+    }
+
+    Acoeffs = A->coeffs + left;
+    Aexps = A->exps + N*left;
+
+    out = -WORD(1);
+    for (in = 0; in < right - left; in++)
+    {
+        if (out >= 0 && mpoly_monomial_equal(Aexps + N*out, Aexps + N*in, N))
+        {
+            fmpz_add(Acoeffs + out, Acoeffs + out, Acoeffs + in);
+        }
+        else
+        {
+            if (out < 0 || !fmpz_is_zero(Acoeffs + out))
+                out++;
+
+            if (out != in)
+            {
+                mpoly_monomial_set(Aexps + N*out, Aexps + N*in, N);
+                fmpz_swap(Acoeffs + out, Acoeffs + in);
+            }
+        }
+    }
+
+    if (out < 0 || !fmpz_is_zero(Acoeffs + out))
+        out++;
+
+    return out;
+}
+
+typedef struct
+{
+    fmpz_mpoly_struct * A;
+    const mpoly_ctx_struct * mctx;
+    slong N;
+    const ulong * cmpmask;
+    /* gathering */
+    fmpz_mpoly_struct ** chunks;
+    slong * offsets;
+    ulong * himasks;
+    /* bucketing */
+    slong num_blocks;
+    slong num_buckets;
+    slong shift;
+    slong pos;
+    ulong totalmask;
+    slong * counts;         /* num_blocks by num_buckets */
+    slong * bucket_starts;  /* num_buckets + 1 */
+    slong * bucket_lengths;
+    fmpz * tcoeffs;
+    ulong * texps;
+}
+_builder_arg_t;
+
+/* move the terms of chunk i into place in A, repacking if needed */
+static void _gather_worker(slong i, _builder_arg_t * arg)
+{
+    fmpz_mpoly_struct * A = arg->A;
+    fmpz_mpoly_struct * C = arg->chunks[i];
+    slong j, N = arg->N, off = arg->offsets[i];
+    ulong himask = 0;
+
+    if (C->bits == A->bits)
+        flint_mpn_copyi(A->exps + N*off, C->exps, N*C->length);
+    else
+        mpoly_repack_monomials(A->exps + N*off, A->bits, C->exps, C->bits,
+                                                  C->length, arg->mctx);
+
+    for (j = 0; j < C->length; j++)
+    {
+        A->coeffs[off + j] = C->coeffs[j];
+        C->coeffs[j] = 0;
+        himask |= A->exps[N*(off + j) + N - 1];
+    }
+
+    arg->himasks[i] = himask;
+}
+
+static slong _block_start(slong k, slong num_blocks, slong length)
+{
+    return (slong) (((double) length)*k/num_blocks);
+}
+
+static slong _bucket(const ulong * exp, const _builder_arg_t * arg)
+{
+    slong N = arg->N;
+    ulong d = ((exp[N - 1] ^ arg->cmpmask[N - 1]) >> arg->shift) &
+                                                       (arg->num_buckets - 1);
+    /* terms are in descending order */
+    return arg->num_buckets - 1 - d;
+}
+
+static void _count_worker(slong k, _builder_arg_t * arg)
+{
+    slong i, N = arg->N;
+    slong start = _block_start(k, arg->num_blocks, arg->A->length);
+    slong stop = _block_start(k + 1, arg->num_blocks, arg->A->length);
+    slong * counts = arg->counts + k*arg->num_buckets;
+
+    for (i = 0; i < arg->num_buckets; i++)
+        counts[i] = 0;
+
+    for (i = start; i < stop; i++)
+        counts[_bucket(arg->A->exps + N*i, arg)]++;
+}
+
+static void _scatter_worker(slong k, _builder_arg_t * arg)
+{
+    slong i, d, N = arg->N;
+    slong start = _block_start(k, arg->num_blocks, arg->A->length);
+    slong stop = _block_start(k + 1, arg->num_blocks, arg->A->length);
+    slong * dests = arg->counts + k*arg->num_buckets;
+
+    for (i = start; i < stop; i++)
+    {
+        d = dests[_bucket(arg->A->exps + N*i, arg)]++;
+        arg->tcoeffs[d] = arg->A->coeffs[i];
+        mpoly_monomial_set(arg->texps + N*d, arg->A->exps + N*i, N);
+    }
+}
+
+static void _bucket_worker(slong b, _builder_arg_t * arg)
+{
+    slong N = arg->N;
+    slong start = arg->bucket_starts[b];
+    slong stop = arg->bucket_starts[b + 1];
+
+    if (start >= stop)
+    {
+        arg->bucket_lengths[b] = 0;
+        return;
+    }
+
+    memcpy(arg->A->coeffs + start, arg->tcoeffs + start,
+                                                     (stop - start)*sizeof(fmpz));
+    flint_mpn_copyi(arg->A->exps + N*start, arg->texps + N*start,
+                                                                N*(stop - start));
+
+    arg->bucket_lengths[b] = _sort_combine_range(arg->A, start, stop,
+                                  arg->pos, N, arg->cmpmask, arg->totalmask);
+}
+
+/*
+    Set A to the sum of all terms pushed to B and empty B.
+    The chunks are gathered, split into buckets by the high bits of the
+    exponents, and each bucket is sorted and combined on its own thread.
+*/
+void fmpz_mpoly_builder_get_fmpz_mpoly(fmpz_mpoly_t A,
+                         fmpz_mpoly_builder_t B, const fmpz_mpoly_ctx_t ctx)
+{
+    slong i, j, k, b, N, length, num_chunks, num_threads;
+    slong msb, len;
+    flint_bitcnt_t bits;
+    ulong himask, * cmpmask;
+    _builder_arg_t arg[1];
+
+    num_chunks = 0;
+    length = 0;
+    bits = MPOLY_MIN_BITS;
+    for (i = 0; i < B->num_lanes; i++)
+    {
+        for (j = 0; j < B->lanes[i].length; j++)
+        {
+            num_chunks++;
+            length += B->lanes[i].chunks[j].length;
+            bits = FLINT_MAX(bits, B->lanes[i].chunks[j].bits);
+        }
+    }
+
+    fmpz_mpoly_fit_length_reset_bits(A, length, bits, ctx);
+    N = mpoly_words_per_exp(bits, ctx->minfo);
+
+    /* the coefficients are moved into A without reference counting */
+    _fmpz_vec_zero(A->coeffs, length);
+    _fmpz_mpoly_set_length(A, length, ctx);
+
+    arg->A = A;
+    arg->mctx = ctx->minfo;
+    arg->N = N;
+    arg->chunks = FLINT_ARRAY_ALLOC(num_chunks, fmpz_mpoly_struct *);
+    arg->offsets = FLINT_ARRAY_ALLOC(num_chunks, slong);
+    arg->himasks = FLINT_ARRAY_ALLOC(num_chunks, ulong);
+
+    k = 0;
+    length = 0;
+    for (i = 0; i < B->num_lanes; i++)
+    {
+        for (j = 0; j < B->lanes[i].length; j++)
+        {
+            arg->chunks[k] = B->lanes[i].chunks + j;
+            arg->offsets[k] = length;
+            length += B->lanes[i].chunks[j].length;
+            k++;
+        }
+
+        B->lanes[i].length = 0;
+    }
+
+    flint_parallel_do((do_func_t) _gather_worker, arg, num_chunks, 0,
+                                                        FLINT_PARALLEL_DYNAMIC);
+    himask = 0;
+    for (k = 0; k < num_chunks; k++)
+        himask |= arg->himasks[k];
+
+    flint_free(arg->chunks);
+    flint_free(arg->offsets);
+    flint_free(arg->himasks);
+
+    num_threads = flint_get_num_threads();
+
+    if (himask != 0)
+    {
+        count_leading_zeros(msb, himask);
+        msb = (FLINT_BITS - 1)^msb;
+    }
+    else
+    {
+        msb = -WORD(1);
+    }
+
+    if (num_threads < 2 || length <= 2*FMPZ_MPOLY_BUILDER_CHUNK || msb < 0)
+    {
+        fmpz_mpoly_sort_terms(A, ctx);
+        fmpz_mpoly_combine_like_terms(A, ctx);
+        return;
+    }
+
+    cmpmask = FLINT_ARRAY_ALLOC(N, ulong);
+    mpoly_get_cmpmask(cmpmask, N, bits, ctx->minfo);
+
+    arg->cmpmask = cmpmask;
+    arg->totalmask = himask;
+    arg->shift = FLINT_MAX(0, msb - (BUILDER_DIGIT_BITS - 1));
+    arg->num_buckets = WORD(1) << (msb - arg->shift + 1);
+    arg->pos = (N - 1)*FLINT_BITS + arg->shift - 1;
+    if (N == 1 && arg->shift == 0)
+        arg->pos = -1;
+    arg->num_blocks = num_threads;
+    arg->counts = FLINT_ARRAY_ALLOC(arg->num_blocks*arg->num_buckets, slong);
+    arg->bucket_starts = FLINT_ARRAY_ALLOC(arg->num_buckets + 1, slong);
+    arg->bucket_lengths = FLINT_ARRAY_ALLOC(arg->num_buckets, slong);
+    arg->tcoeffs = FLINT_ARRAY_ALLOC(length, fmpz);
+    arg->texps = FLINT_ARRAY_ALLOC(N*length, ulong);
+
+    flint_parallel_do((do_func_t) _count_worker, arg, arg->num_blocks, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+
+    /* turn the counts into destinations */
+    len = 0;
+    for (b = 0; b < arg->num_buckets; b++)
+    {
+        arg->bucket_starts[b] = len;
+        for (k = 0; k < arg->num_blocks; k++)
+        {
+            slong c = arg->counts[k*arg->num_buckets + b];
+            arg->counts[k*arg->num_buckets + b] = len;
+            len += c;
+        }
+    }
+    arg->bucket_starts[arg->num_buckets] = len;
+    FLINT_ASSERT(len == length);
+
+    flint_parallel_do((do_func_t) _scatter_worker, arg, arg->num_blocks, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+
+    flint_parallel_do((do_func_t) _bucket_worker, arg, arg->num_buckets, 0,
+                                                        FLINT_PARALLEL_DYNAMIC);
+
+    /* close the gaps left by combining */
+    len = 0;
+    for (b = 0; b < arg->num_buckets; b++)
+    {
+        slong start = arg->bucket_starts[b];
+
+        if (start != len)
+        {
+            for (i = 0; i < arg->bucket_lengths[b]; i++)
+            {
+                fmpz_swap(A->coeffs + len + i, A->coeffs + start + i);
+                mpoly_monomial_set(A->exps + N*(len + i),
+                                                    A->exps + N*(start + i), N);
+            }
+        }
+
+        len += arg->bucket_lengths[b];
+    }
+
+    _fmpz_mpoly_set_length(A, len, ctx);
+
+    flint_free(cmpmask);
+    flint_free(arg->counts);
+    flint_free(arg->bucket_starts);
+    flint_free(arg->bucket_lengths);
+    flint_free(arg->tcoeffs);
+    flint_free(arg->texps);
+}
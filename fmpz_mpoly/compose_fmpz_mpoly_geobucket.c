@@ -10,15 +10,19 @@
 */
 
 #include "fmpz_mpoly.h"
+#include "thread_support.h"
 
-/* evaluate B(xbar) at xbar = C */
-int fmpz_mpoly_compose_fmpz_mpoly_geobucket(fmpz_mpoly_t A,
-                  const fmpz_mpoly_t B, fmpz_mpoly_struct * const * C,
-                     const fmpz_mpoly_ctx_t ctxB, const fmpz_mpoly_ctx_t ctxAC)
+/* minimum number of terms of B in each block handed to a thread */
+#define COMPOSE_TERMS_PER_BLOCK 8
+
+/* A = sum of the terms [start, stop) of B evaluated at xbar = C */
+static int _compose_terms(fmpz_mpoly_t A,
+                  const fmpz_mpoly_t B, slong start, slong stop,
+                  fmpz_mpoly_struct * const * C,
+                  const fmpz_mpoly_ctx_t ctxB, const fmpz_mpoly_ctx_t ctxAC)
 {
     int success = 1;
     slong i, j;
-    slong Blen = B->length;
     const fmpz * Bcoeff = B->coeffs;
     const ulong * Bexp = B->exps;
     flint_bitcnt_t Bbits = B->bits;
@@ -33,7 +37,7 @@ int fmpz_mpoly_compose_fmpz_mpoly_geobucket(fmpz_mpoly_t A,
     fmpz_mpoly_geobucket_init(T, ctxAC);
     e = _fmpz_vec_init(ctxB->minfo->nvars);
 
-    for (i = 0; success && i < Blen; i++)
+    for (i = start; success && i < stop; i++)
     {
         fmpz_mpoly_set_fmpz(U, Bcoeff + i, ctxAC);
         mpoly_get_monomial_ffmpz(e, Bexp + BN*i, Bbits, ctxB->minfo);
@@ -58,3 +62,76 @@ int fmpz_mpoly_compose_fmpz_mpoly_geobucket(fmpz_mpoly_t A,
     return success;
 }
 
+typedef struct
+{
+    fmpz_mpoly_struct * sums;
+    int * success;
+    const fmpz_mpoly_struct * B;
+    fmpz_mpoly_struct * const * C;
+    const fmpz_mpoly_ctx_struct * ctxB;
+    const fmpz_mpoly_ctx_struct * ctxAC;
+    slong num_blocks;
+}
+_compose_arg_t;
+
+static void _compose_worker(slong b, _compose_arg_t * arg)
+{
+    slong start = (b * arg->B->length) / arg->num_blocks;
+    slong stop = ((b + 1) * arg->B->length) / arg->num_blocks;
+
+    arg->success[b] = _compose_terms(arg->sums + b, arg->B, start, stop,
+                                              arg->C, arg->ctxB, arg->ctxAC);
+}
+
+/*
+    evaluate B(xbar) at xbar = C
+
+    With several threads the terms of B are cut into blocks, each of which
+    is summed in its own geobucket, and the block sums are added at the end.
+*/
+int fmpz_mpoly_compose_fmpz_mpoly_geobucket(fmpz_mpoly_t A,
+                  const fmpz_mpoly_t B, fmpz_mpoly_struct * const * C,
+                     const fmpz_mpoly_ctx_t ctxB, const fmpz_mpoly_ctx_t ctxAC)
+{
+    int success = 1;
+    slong b, num_blocks, num_threads = flint_get_num_threads();
+    _compose_arg_t arg;
+
+    num_blocks = FLINT_MIN(4*num_threads, B->length/COMPOSE_TERMS_PER_BLOCK);
+
+    if (num_threads <= 1 || num_blocks <= 1)
+        return _compose_terms(A, B, 0, B->length, C, ctxB, ctxAC);
+
+    arg.sums = (fmpz_mpoly_struct *) flint_malloc(
+                                       num_blocks*sizeof(fmpz_mpoly_struct));
+    arg.success = (int *) flint_malloc(num_blocks*sizeof(int));
+    arg.B = B;
+    arg.C = C;
+    arg.ctxB = ctxB;
+    arg.ctxAC = ctxAC;
+    arg.num_blocks = num_blocks;
+
+    for (b = 0; b < num_blocks; b++)
+        fmpz_mpoly_init(arg.sums + b, ctxAC);
+
+    flint_parallel_do((do_func_t) _compose_worker, &arg, num_blocks, 0,
+                                                        FLINT_PARALLEL_DYNAMIC);
+
+    for (b = 0; b < num_blocks; b++)
+        success = success && arg.success[b];
+
+    if (success)
+    {
+        fmpz_mpoly_swap(A, arg.sums + 0, ctxAC);
+        for (b = 1; b < num_blocks; b++)
+            fmpz_mpoly_add(A, A, arg.sums + b, ctxAC);
+    }
+
+    for (b = 0; b < num_blocks; b++)
+        fmpz_mpoly_clear(arg.sums + b, ctxAC);
+
+    flint_free(arg.sums);
+    flint_free(arg.success);
+
+    return success;
+}
@@ -10,6 +10,10 @@
 */
 
 #include "fmpz_mpoly.h"
+#include "thread_support.h"
+
+/* minimum number of terms handed to each thread */
+#define EVAL_TERMS_PER_THREAD 1000
 
 /* given the exponent and the bit count of the base, can we expect b^e to fail */
 int _fmpz_pow_fmpz_is_not_feasible(flint_bitcnt_t bbits, const fmpz_t e)
@@ -25,6 +29,95 @@ int _fmpz_pow_ui_is_not_feasible(flint_bitcnt_t bbits, ulong e)
     return bbits > 1 && e >= limit/bbits;
 }
 
+/*
+    The powers val[i]^(2^j) are shared read only by all threads, each of which
+    sums the terms in a contiguous block of A into its own entry of sums.
+*/
+typedef struct
+{
+    fmpz * sums;
+    const fmpz * Acoeff;
+    const ulong * Aexp;
+    slong Alen;
+    slong N;
+    const slong * offs;
+    const ulong * masks;
+    const fmpz * powers;
+    slong k_len;
+    slong num_blocks;
+}
+_eval_arg_t;
+
+static void
+_eval_terms(fmpz_t ev, const _eval_arg_t * arg, slong start, slong stop)
+{
+    slong i, k, N = arg->N;
+    fmpz_t t;
+
+    fmpz_zero(ev);
+    fmpz_init(t);
+    for (i = start; i < stop; i++)
+    {
+        fmpz_set(t, arg->Acoeff + i);
+        for (k = 0; k < arg->k_len; k++)
+        {
+            if ((arg->Aexp[N*i + arg->offs[k]] & arg->masks[k]) != WORD(0))
+                fmpz_mul(t, t, arg->powers + k);
+        }
+        fmpz_add(ev, ev, t);
+    }
+    fmpz_clear(t);
+}
+
+static void
+_eval_worker(slong b, _eval_arg_t * arg)
+{
+    slong start = (b * arg->Alen) / arg->num_blocks;
+    slong stop = ((b + 1) * arg->Alen) / arg->num_blocks;
+
+    _eval_terms(arg->sums + b, arg, start, stop);
+}
+
+static void
+_fmpz_mpoly_evaluate_all_accumulate(fmpz_t ev, const fmpz * Acoeff,
+                        const ulong * Aexp, slong Alen, slong N,
+                        const slong * offs, const ulong * masks,
+                        const fmpz * powers, slong k_len)
+{
+    slong b, num_blocks;
+    _eval_arg_t arg;
+
+    arg.Acoeff = Acoeff;
+    arg.Aexp = Aexp;
+    arg.Alen = Alen;
+    arg.N = N;
+    arg.offs = offs;
+    arg.masks = masks;
+    arg.powers = powers;
+    arg.k_len = k_len;
+
+    num_blocks = FLINT_MIN(flint_get_num_threads(),
+                                                Alen / EVAL_TERMS_PER_THREAD);
+
+    if (num_blocks <= 1)
+    {
+        _eval_terms(ev, &arg, 0, Alen);
+        return;
+    }
+
+    arg.num_blocks = num_blocks;
+    arg.sums = _fmpz_vec_init(num_blocks);
+
+    flint_parallel_do((do_func_t) _eval_worker, &arg, num_blocks, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+
+    fmpz_zero(ev);
+    for (b = 0; b < num_blocks; b++)
+        fmpz_add(ev, ev, arg.sums + b);
+
+    _fmpz_vec_clear(arg.sums, num_blocks);
+}
+
 int _fmpz_mpoly_evaluate_all_fmpz_sp(fmpz_t ev, const fmpz_mpoly_t A,
                                 fmpz * const * val, const fmpz_mpoly_ctx_t ctx)
 {
@@ -39,7 +132,6 @@ int _fmpz_mpoly_evaluate_all_fmpz_sp(fmpz_t ev, const fmpz_mpoly_t A,
     slong * offs;
     ulong * masks;
     fmpz * powers;
-    fmpz_t t;
     TMP_INIT;
 
     FLINT_ASSERT(Alen > 0);
@@ -90,19 +182,8 @@ int _fmpz_mpoly_evaluate_all_fmpz_sp(fmpz_t ev, const fmpz_mpoly_t A,
     FLINT_ASSERT(k_len == entries);
 
     /* accumulate answer */
-    fmpz_zero(ev);
-    fmpz_init(t);
-    for (i = 0; i < Alen; i++)
-    {
-        fmpz_set(t, Acoeff + i);
-        for (k = 0; k < k_len; k++)
-        {
-            if ((Aexp[N*i + offs[k]] & masks[k]) != WORD(0))
-                fmpz_mul(t, t, powers + k);
-        }
-        fmpz_add(ev, ev, t);
-    }
-    fmpz_clear(t);
+    _fmpz_mpoly_evaluate_all_accumulate(ev, Acoeff, Aexp, Alen, N,
+                                                   offs, masks, powers, k_len);
 
     for (k = 0; k < k_len; k++)
         fmpz_clear(powers + k);
@@ -128,7 +209,6 @@ int _fmpz_mpoly_evaluate_all_fmpz_mp(fmpz_t ev, const fmpz_mpoly_t A,
     slong * offs;
     ulong * masks;
     fmpz * powers;
-    fmpz_t t;
     TMP_INIT;
 
     FLINT_ASSERT(Alen > 0);
@@ -179,19 +259,8 @@ int _fmpz_mpoly_evaluate_all_fmpz_mp(fmpz_t ev, const fmpz_mpoly_t A,
     FLINT_ASSERT(k_len == entries);
 
     /* accumulate answer */
-    fmpz_zero(ev);
-    fmpz_init(t);
-    for (i = 0; i < Alen; i++)
-    {
-        fmpz_set(t, Acoeff + i);
-        for (k = 0; k < k_len; k++)
-        {
-            if ((Aexp[N*i + offs[k]] & masks[k]) != WORD(0))
-                fmpz_mul(t, t, powers + k);
-        }
-        fmpz_add(ev, ev, t);
-    }
-    fmpz_clear(t);
+    _fmpz_mpoly_evaluate_all_accumulate(ev, Acoeff, Aexp, Alen, N,
+                                                   offs, masks, powers, k_len);
 
     for (k = 0; k < k_len; k++)
         fmpz_clear(powers + k);
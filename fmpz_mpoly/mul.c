@@ -11,6 +11,7 @@
 
 #include "fmpz_mpoly.h"
 #include "long_extras.h"
+#include "fft_tuning.h"
 
 
 static int _try_dense(int try_array, slong * Bdegs, slong * Cdegs,
@@ -63,7 +64,7 @@ static int _try_array_LEX(slong * Bdegs, slong * Cdegs,
     FLINT_ASSERT(Blen > 0);
     FLINT_ASSERT(Clen > 0);
 
-    /* accept array method if the array is probably at least 10% full */
+    /* accept array method if the array is probably full enough */
 
     dense_size = WORD(1);
     for (i = 0; i < nvars; i++)
@@ -74,7 +75,7 @@ static int _try_array_LEX(slong * Bdegs, slong * Cdegs,
     }
 
     return dense_size <= WORD(50000000) &&
-           dense_size/Blen/Clen < WORD(10);
+           dense_size/Blen/Clen < FMPZ_MPOLY_MUL_ARRAY_CUTOFF;
 }
 
 
@@ -105,7 +106,7 @@ static int _try_array_DEG(slong Btotaldeg, slong Ctotaldeg,
     }
 
     return dense_size <= WORD(5000000) &&
-           dense_size/Blen/Clen < WORD(10);
+           dense_size/Blen/Clen < FMPZ_MPOLY_MUL_ARRAY_CUTOFF;
 }
 
 /* !!! this function DOES need to change with new orderings */
@@ -0,0 +1,173 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "thread_support.h"
+#include "fmpz_mpoly.h"
+
+typedef struct
+{
+    fmpz_mpoly_builder_struct * B;
+    const fmpz_mpoly_struct * T;
+    const slong * lanes;
+    const fmpz_mpoly_ctx_struct * ctx;
+}
+push_arg_t;
+
+/* push the terms of T assigned to the given lane */
+static void push_worker(slong lane, push_arg_t * arg)
+{
+    slong i;
+    ulong * exp = FLINT_ARRAY_ALLOC(arg->ctx->minfo->nvars, ulong);
+    fmpz * c;
+
+    for (i = 0; i < arg->T->length; i++)
+    {
+        if (arg->lanes[i] != lane)
+            continue;
+
+        c = arg->T->coeffs + i;
+        fmpz_mpoly_get_term_exp_ui(exp, arg->T, i, arg->ctx);
+
+        if (i % 3 == 0 && fmpz_fits_si(c))
+            fmpz_mpoly_builder_push_term_si_ui(arg->B, lane,
+                                               fmpz_get_si(c), exp, arg->ctx);
+        else if (i % 3 == 1 && fmpz_sgn(c) >= 0 && fmpz_abs_fits_ui(c))
+            fmpz_mpoly_builder_push_term_ui_ui(arg->B, lane,
+                                               fmpz_get_ui(c), exp, arg->ctx);
+        else
+            fmpz_mpoly_builder_push_term_fmpz_ui(arg->B, lane, c, exp, arg->ctx);
+    }
+
+    flint_free(exp);
+}
+
+int
+main(void)
+{
+    slong i, j;
+    const slong max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("builder....");
+    fflush(stdout);
+
+    /* Check building from split, cancelling and scrambled terms */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fmpz_mpoly_ctx_t ctx;
+        fmpz_mpoly_t f, g, t;
+        fmpz_mpoly_builder_t B;
+        fmpz_t c;
+        ulong * exp;
+        slong * lanes;
+        slong len, num_lanes, N, k;
+        flint_bitcnt_t coeff_bits, exp_bits;
+        push_arg_t arg[1];
+
+        fmpz_mpoly_ctx_init_rand(ctx, state, 10);
+
+        fmpz_mpoly_init(f, ctx);
+        fmpz_mpoly_init(g, ctx);
+        fmpz_mpoly_init(t, ctx);
+        fmpz_init(c);
+        exp = FLINT_ARRAY_ALLOC(ctx->minfo->nvars, ulong);
+
+        num_lanes = n_randint(state, max_threads) + 1;
+        fmpz_mpoly_builder_init(B, num_lanes, ctx);
+
+        for (j = 0; j < 3; j++)
+        {
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+            len = n_randint(state, 200);
+            if (n_randint(state, 8) == 0)
+                len += n_randint(state, 10000);
+            exp_bits = n_randint(state, FLINT_BITS - 1) + 1;
+            coeff_bits = n_randint(state, 100);
+
+            fmpz_mpoly_randtest_bits(f, state, len, coeff_bits, exp_bits, ctx);
+
+            /* split each term in two and add some pairs that cancel */
+            fmpz_mpoly_zero(t, ctx);
+            for (k = 0; k < f->length; k++)
+            {
+                fmpz_mpoly_get_term_exp_ui(exp, f, k, ctx);
+                fmpz_randtest(c, state, coeff_bits + 1);
+                fmpz_mpoly_push_term_fmpz_ui(t, c, exp, ctx);
+                fmpz_sub(c, f->coeffs + k, c);
+                fmpz_mpoly_push_term_fmpz_ui(t, c, exp, ctx);
+
+                if (ctx->minfo->nvars > 0 && n_randint(state, 4) == 0)
+                {
+                    fmpz_mpoly_get_term_exp_ui(exp, f, n_randint(state,
+                                                               f->length), ctx);
+                    exp[n_randint(state, ctx->minfo->nvars)] ^= 1;
+                    fmpz_randtest_not_zero(c, state, coeff_bits + 1);
+                    fmpz_mpoly_push_term_fmpz_ui(t, c, exp, ctx);
+                    fmpz_neg(c, c);
+                    fmpz_mpoly_push_term_fmpz_ui(t, c, exp, ctx);
+                }
+            }
+
+            N = mpoly_words_per_exp(t->bits, ctx->minfo);
+            for (k = 0; k < t->length; k++)
+            {
+                ulong a, b;
+                a = n_randint(state, t->length);
+                b = n_randint(state, t->length);
+                fmpz_swap(t->coeffs + a, t->coeffs + b);
+                mpoly_monomial_swap(t->exps + N*a, t->exps + N*b, N);
+            }
+
+            lanes = FLINT_ARRAY_ALLOC(t->length + 1, slong);
+            for (k = 0; k < t->length; k++)
+                lanes[k] = n_randint(state, num_lanes);
+
+            arg->B = B;
+            arg->T = t;
+            arg->lanes = lanes;
+            arg->ctx = ctx;
+            flint_parallel_do((do_func_t) push_worker, arg, num_lanes, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+
+            fmpz_mpoly_randtest_bits(g, state, 10, coeff_bits, exp_bits, ctx);
+            fmpz_mpoly_builder_get_fmpz_mpoly(g, B, ctx);
+            fmpz_mpoly_assert_canonical(g, ctx);
+
+            if (!fmpz_mpoly_equal(f, g, ctx))
+            {
+                printf("FAIL\n");
+                flint_printf("Check building from split, cancelling and "
+                                  "scrambled terms\ni = %wd, j = %wd\n", i, j);
+                fflush(stdout);
+                flint_abort();
+            }
+
+            flint_free(lanes);
+        }
+
+        fmpz_mpoly_builder_clear(B, ctx);
+
+        flint_free(exp);
+        fmpz_clear(c);
+        fmpz_mpoly_clear(f, ctx);
+        fmpz_mpoly_clear(g, ctx);
+        fmpz_mpoly_clear(t, ctx);
+        fmpz_mpoly_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
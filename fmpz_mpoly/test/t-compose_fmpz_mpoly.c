@@ -17,6 +17,7 @@ int
 main(void)
 {
     slong i, j, v;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("compose_fmpz_mpoly....");
@@ -127,6 +128,8 @@ main(void)
 
         for (j = 0; j < 4; j++)
         {
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
             len = n_randint(state, 200);
             exp_bits = n_randint(state, 100) + 1;
             coeff_bits = n_randint(state, 100) + 1;
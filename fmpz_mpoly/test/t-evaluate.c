@@ -17,6 +17,7 @@ int
 main(void)
 {
     slong i, j, v;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("evaluate_one_fmpz/all_fmpz....");
@@ -446,6 +447,90 @@ main(void)
 
     }
 
+    /* Check threaded evalall matches single threaded evalall */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_mpoly_ctx_t ctx;
+        fmpz_mpoly_t f;
+        fmpz_t fe1, fe2;
+        fmpz ** vals;
+        mp_limb_t * nvals, fn1, fn2;
+        nmod_t mod;
+        slong nvars, len;
+        flint_bitcnt_t exp_bits, coeff_bits;
+
+        fmpz_mpoly_ctx_init_rand(ctx, state, 6);
+        nvars = ctx->minfo->nvars;
+
+        fmpz_mpoly_init(f, ctx);
+        fmpz_init(fe1);
+        fmpz_init(fe2);
+
+        nmod_init(&mod, n_randtest_not_zero(state));
+
+        len = n_randint(state, 6000);
+        exp_bits = n_randint(state, 2) ? n_randint(state, 8) + 1 :
+                                         n_randint(state, 100) + 1;
+        coeff_bits = n_randint(state, 100) + 1;
+
+        vals = (fmpz **) flint_malloc(nvars*sizeof(fmpz*));
+        nvals = (mp_limb_t *) flint_malloc(nvars*sizeof(mp_limb_t));
+        for (v = 0; v < nvars; v++)
+        {
+            vals[v] = (fmpz *) flint_malloc(sizeof(fmpz));
+            fmpz_init(vals[v]);
+            if (exp_bits > 8)
+                fmpz_set_si(vals[v], n_randint(state, UWORD(3)) - WORD(1));
+            else
+                fmpz_randtest(vals[v], state, 10);
+            nvals[v] = n_randtest(state);
+        }
+
+        fmpz_mpoly_randtest_bits(f, state, len, coeff_bits, exp_bits, ctx);
+
+        flint_set_num_threads(1);
+        if (!fmpz_mpoly_evaluate_all_fmpz(fe1, f, vals, ctx))
+        {
+            printf("FAIL\n");
+            flint_printf("Check threaded evalall success\ni: %wd\n", i);
+            fflush(stdout);
+            flint_abort();
+        }
+        fn1 = fmpz_mpoly_evaluate_all_nmod(f, nvals, ctx, mod);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+        if (!fmpz_mpoly_evaluate_all_fmpz(fe2, f, vals, ctx))
+        {
+            printf("FAIL\n");
+            flint_printf("Check threaded evalall success\ni: %wd\n", i);
+            fflush(stdout);
+            flint_abort();
+        }
+        fn2 = fmpz_mpoly_evaluate_all_nmod(f, nvals, ctx, mod);
+
+        if (!fmpz_equal(fe1, fe2) || fn1 != fn2)
+        {
+            printf("FAIL\n");
+            flint_printf("Check threaded evalall matches single threaded evalall\n"
+                                                               "i: %wd\n", i);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        for (v = 0; v < nvars; v++)
+        {
+            fmpz_clear(vals[v]);
+            flint_free(vals[v]);
+        }
+        flint_free(vals);
+        flint_free(nvals);
+
+        fmpz_mpoly_clear(f, ctx);
+        fmpz_clear(fe1);
+        fmpz_clear(fe2);
+        fmpz_mpoly_ctx_clear(ctx);
+    }
+
     printf("PASS\n");
     FLINT_TEST_CLEANUP(state);
 
@@ -104,6 +104,7 @@ int
 main(void)
 {
     slong i, j, tmul = 20;
+    const slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("gcd_hensel....");
@@ -173,6 +174,8 @@ main(void)
             coeff_bits = n_randint(state, 300) + 10;
             fmpz_mpoly_randtest_bits(g, state, coeff_bits, len, FLINT_BITS, ctx);
 
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
             if (a->length < 4000 && b->length < 4000)
                 gcd_check(g, a, b, t3, ctx, i, j, "random");
         }
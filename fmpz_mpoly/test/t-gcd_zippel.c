@@ -15,6 +15,7 @@ int
 main(void)
 {
     slong i, j;
+    const slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("gcd_zippel....");
@@ -180,6 +181,8 @@ main(void)
 
             fmpz_mpoly_randtest_bits(g, state, len, coeff_bits, FLINT_BITS, ctx);
 
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
             res = fmpz_mpoly_gcd_zippel(g, a, b, ctx);
             fmpz_mpoly_assert_canonical(g, ctx);
 
@@ -13,6 +13,7 @@
 #include "fmpq_poly.h"
 #include "fmpz_mod_mpoly.h"
 #include "nmod_mpoly_factor.h"
+#include "thread_support.h"
 
 
 /* A has degree 2 wrt gen(0) */
@@ -571,12 +572,29 @@ cleanup_less:
 }
 
 
+typedef struct
+{
+    fmpz_mpolyv_struct * t;
+    fmpz_mpoly_struct * polys;
+    int * success;
+    const fmpz_mpoly_ctx_struct * ctx;
+    unsigned int algo;
+}
+_factor_irred_arg_t;
+
+static void _factor_irred_worker(slong j, _factor_irred_arg_t * arg)
+{
+    arg->success[j] = _factor_irred(arg->t + j, arg->polys + j,
+                                                        arg->ctx, arg->algo);
+}
+
 /*
     for each factor A in f, assume A satifies _factor_irred requirements:
         A is primitive w.r.t to any variable appearing in A.
         A is squarefree with positive lead coeff.
 
     Replace f by and irreducible factorization.
+    The factors of f are independent and are factored on separate threads.
 */
 int fmpz_mpoly_factor_irred(
     fmpz_mpoly_factor_t f,
@@ -584,26 +602,42 @@ int fmpz_mpoly_factor_irred(
     unsigned int algo)
 {
     int success;
-    slong i, j;
-    fmpz_mpolyv_t t;
+    slong i, j, num = f->num;
+    fmpz_mpolyv_struct * t;
+    int * successes;
     fmpz_mpoly_factor_t g;
+    _factor_irred_arg_t arg[1];
 
-    fmpz_mpolyv_init(t, ctx);
+    t = FLINT_ARRAY_ALLOC(num, fmpz_mpolyv_struct);
+    successes = FLINT_ARRAY_ALLOC(num, int);
+    for (j = 0; j < num; j++)
+        fmpz_mpolyv_init(t + j, ctx);
     fmpz_mpoly_factor_init(g, ctx);
 
-    fmpz_swap(g->constant, f->constant);
-    g->num = 0;
-    for (j = 0; j < f->num; j++)
+    arg->t = t;
+    arg->polys = f->poly;
+    arg->success = successes;
+    arg->ctx = ctx;
+    arg->algo = algo;
+    flint_parallel_do((do_func_t) _factor_irred_worker, arg, num, 0,
+                                                        FLINT_PARALLEL_DYNAMIC);
+
+    for (j = 0; j < num; j++)
     {
-        success = _factor_irred(t, f->poly + j, ctx, algo);
+        success = successes[j];
         if (!success)
             goto cleanup;
+    }
 
-        fmpz_mpoly_factor_fit_length(g, g->num + t->length, ctx);
-        for (i = 0; i < t->length; i++)
+    fmpz_swap(g->constant, f->constant);
+    g->num = 0;
+    for (j = 0; j < num; j++)
+    {
+        fmpz_mpoly_factor_fit_length(g, g->num + t[j].length, ctx);
+        for (i = 0; i < t[j].length; i++)
         {
             fmpz_set(g->exp + g->num, f->exp + j);
-            fmpz_mpoly_swap(g->poly + g->num, t->coeffs + i, ctx);
+            fmpz_mpoly_swap(g->poly + g->num, t[j].coeffs + i, ctx);
             g->num++;
         }
     }
@@ -613,7 +647,10 @@ int fmpz_mpoly_factor_irred(
 
 cleanup:
 
-    fmpz_mpolyv_clear(t, ctx);
+    for (j = 0; j < num; j++)
+        fmpz_mpolyv_clear(t + j, ctx);
+    flint_free(t);
+    flint_free(successes);
     fmpz_mpoly_factor_clear(g, ctx);
 
     return success;
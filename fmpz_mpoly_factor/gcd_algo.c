@@ -1357,6 +1357,8 @@ static int _try_brown(
     flint_bitcnt_t wbits;
     fmpz_mpoly_ctx_t lctx;
     fmpz_mpoly_t Al, Bl, Gl, Abarl, Bbarl;
+    thread_pool_handle * handles;
+    slong num_handles;
 
     if (!(I->can_use & MPOLY_GCD_USE_BROWN))
         return 0;
@@ -1385,7 +1387,16 @@ static int _try_brown(
     FLINT_ASSERT(Al->length > 1);
     FLINT_ASSERT(Bl->length > 1);
 
-    success = fmpz_mpolyl_gcd_brown(Gl, Abarl, Bbarl, Al, Bl, lctx, I);
+    num_handles = flint_request_threads(&handles, flint_get_num_threads());
+
+    if (num_handles > 0)
+        success = fmpz_mpolyl_gcd_brown_threaded_pool(Gl, Abarl, Bbarl, Al, Bl,
+                                                  lctx, I, handles, num_handles);
+    else
+        success = fmpz_mpolyl_gcd_brown(Gl, Abarl, Bbarl, Al, Bl, lctx, I);
+
+    flint_give_back_threads(handles, num_handles);
+
     if (!success)
         goto cleanup;
 
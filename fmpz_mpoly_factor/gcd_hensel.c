@@ -10,6 +10,40 @@
 */
 
 #include "fmpz_mpoly_factor.h"
+#include "thread_support.h"
+
+/*
+    The evaluation chains of A and B and the two final cofactor divisions
+    are independent, so each pair is run on two threads when available.
+*/
+typedef struct
+{
+    fmpz_mpoly_struct * evals[2];
+    const fmpz_mpoly_struct * polys[2];
+    const fmpz * alphas;
+    slong n;
+    fmpz_mpoly_struct * quos[2];
+    const fmpz_mpoly_struct * dens[2];
+    int success[2];
+    const fmpz_mpoly_ctx_struct * ctx;
+}
+_hensel_arg_t;
+
+static void _eval_chain_worker(slong k, _hensel_arg_t * arg)
+{
+    slong i;
+    fmpz_mpoly_struct * E = arg->evals[k];
+
+    for (i = arg->n - 1; i >= 0; i--)
+        fmpz_mpoly_evaluate_one_fmpz(E + i, i == arg->n - 1 ? arg->polys[k] :
+                                      E + i + 1, i + 1, arg->alphas + i, arg->ctx);
+}
+
+static void _divides_worker(slong k, _hensel_arg_t * arg)
+{
+    arg->success[k] = fmpz_mpoly_divides(arg->quos[k], arg->polys[k],
+                                                      arg->dens[k], arg->ctx);
+}
 
 int fmpz_mpolyl_gcd_hensel(
     fmpz_mpoly_t G, slong Gdeg, /* upperbound on deg_X(G) */
@@ -34,6 +68,7 @@ int fmpz_mpolyl_gcd_hensel(
     slong Adegx, Bdegx, gdegx;
     fmpz_mpoly_t t1, t2, g, abar, bbar, hbar;
     flint_rand_t state;
+    _hensel_arg_t arg[1];
 
     FLINT_ASSERT(n > 0);
     FLINT_ASSERT(A->length > 0);
@@ -128,12 +163,17 @@ got_alpha:
     /* ensure deg_X do not drop under evaluation */
     Adegx = fmpz_mpoly_degree_si(A, 0, ctx);
     Bdegx = fmpz_mpoly_degree_si(B, 0, ctx);
+    arg->evals[0] = Aevals;
+    arg->evals[1] = Bevals;
+    arg->polys[0] = A;
+    arg->polys[1] = B;
+    arg->alphas = alphas;
+    arg->n = n;
+    arg->ctx = ctx;
+    flint_parallel_do((do_func_t) _eval_chain_worker, arg, 2, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
     for (i = n - 1; i >= 0; i--)
     {
-        fmpz_mpoly_evaluate_one_fmpz(Aevals + i, i == n - 1 ? A :
-                                       Aevals + i + 1, i + 1, alphas + i, ctx);
-        fmpz_mpoly_evaluate_one_fmpz(Bevals + i, i == n - 1 ? B :
-                                       Bevals + i + 1, i + 1, alphas + i, ctx);
         if (Adegx != fmpz_mpoly_degree_si(Aevals + i, 0, ctx) ||
             Bdegx != fmpz_mpoly_degree_si(Bevals + i, 0, ctx))
         {
@@ -370,8 +410,15 @@ got_alpha:
     }
     else
     {
-        success = fmpz_mpoly_divides(Abar, A, G, ctx) &&
-                  fmpz_mpoly_divides(Bbar, B, G, ctx);
+        arg->quos[0] = Abar;
+        arg->quos[1] = Bbar;
+        arg->polys[0] = A;
+        arg->polys[1] = B;
+        arg->dens[0] = G;
+        arg->dens[1] = G;
+        flint_parallel_do((do_func_t) _divides_worker, arg, 2, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+        success = arg->success[0] && arg->success[1];
     }
 
     if (!success)
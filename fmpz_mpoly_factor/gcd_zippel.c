@@ -11,6 +11,7 @@
 
 #include "nmod_mpoly_factor.h"
 #include "fmpz_mpoly_factor.h"
+#include "thread_support.h"
 
 /* return an n with |gcd(A,B)|_infty < 2^n or return UWORD_MAX */
 static flint_bitcnt_t fmpz_mpoly_gcd_bitbound(
@@ -48,6 +49,58 @@ static flint_bitcnt_t fmpz_mpoly_gcd_bitbound(
     return bound;
 }
 
+/* one image of the gcd modulo a prime, computed from the known form of G */
+typedef struct
+{
+    mp_limb_t p;
+    int success;
+    slong Gdegbound;
+    nmod_mpoly_ctx_t ctxp;
+    nmod_mpoly_t Ap, Bp, Gp;
+    n_poly_t Amarks, Bmarks;
+    flint_rand_t state;
+}
+_zip_image_struct;
+
+typedef struct
+{
+    _zip_image_struct * images;
+    const fmpz_mpoly_struct * A;
+    const fmpz_mpoly_struct * B;
+    const fmpz_mpoly_ctx_struct * ctx;
+    const nmod_mpoly_struct * Gp;
+    const n_poly_struct * Gmarks;
+    slong * perm;
+    slong req_zip_images;
+    slong Gdegbound;
+}
+_zip_arg_t;
+
+static void _zip_worker(slong k, _zip_arg_t * arg)
+{
+    _zip_image_struct * I = arg->images + k;
+
+    nmod_mpoly_ctx_change_modulus(I->ctxp, I->p);
+
+    /* make sure mod p reduction does not kill either A or B */
+    fmpz_mpoly_interp_reduce_p(I->Ap, I->ctxp, arg->A, arg->ctx);
+    fmpz_mpoly_interp_reduce_p(I->Bp, I->ctxp, arg->B, arg->ctx);
+    if (I->Ap->length == 0 || I->Bp->length == 0)
+    {
+        I->success = -1;
+        return;
+    }
+
+    /* the form of G, the coefficients are overwritten */
+    nmod_mpoly_set(I->Gp, arg->Gp, I->ctxp);
+    I->Gdegbound = arg->Gdegbound;
+
+    I->success = nmod_mpolyl_gcds_zippel(I->Gp, arg->Gmarks->coeffs,
+                        arg->Gmarks->length, I->Ap, I->Bp, arg->perm,
+                        arg->req_zip_images, arg->ctx->minfo->nvars, I->ctxp,
+                        I->state, &I->Gdegbound, I->Amarks, I->Bmarks);
+}
+
 int fmpz_mpolyl_gcd_zippel(
     fmpz_mpoly_t G,
     fmpz_mpoly_t Abar,
@@ -61,7 +114,10 @@ int fmpz_mpolyl_gcd_zippel(
     flint_bitcnt_t coeffbits;
     flint_bitcnt_t bits = G->bits;
     int success, changed;
-    slong i, j, Gdegbound, Gdeg, req_zip_images;
+    slong i, j, k, Gdegbound, Gdeg, req_zip_images;
+    slong num_images = flint_get_num_threads();
+    _zip_image_struct * images;
+    _zip_arg_t arg[1];
     mp_limb_t p, t, gammap;
     fmpz_t c, gamma, modulus;
     nmod_mpoly_t Ap, Bp, Gp, Abarp, Bbarp;
@@ -94,6 +150,23 @@ int fmpz_mpolyl_gcd_zippel(
     n_poly_init(Bmarks);
     n_poly_init(Gmarks);
 
+    images = FLINT_ARRAY_ALLOC(num_images, _zip_image_struct);
+    for (k = 0; k < num_images; k++)
+    {
+        nmod_mpoly_ctx_init(images[k].ctxp, ctx->minfo->nvars, ORD_LEX, 2);
+        nmod_mpoly_init3(images[k].Ap, 0, bits, images[k].ctxp);
+        nmod_mpoly_init3(images[k].Bp, 0, bits, images[k].ctxp);
+        nmod_mpoly_init3(images[k].Gp, 0, bits, images[k].ctxp);
+        n_poly_init(images[k].Amarks);
+        n_poly_init(images[k].Bmarks);
+        flint_randinit(images[k].state);
+        flint_randseed(images[k].state, n_randlimb(state), n_randlimb(state));
+    }
+
+    arg->A = A;
+    arg->B = B;
+    arg->ctx = ctx;
+
     fmpz_gcd(gamma, fmpz_mpoly_leadcoeff(A), fmpz_mpoly_leadcoeff(B));
 
     Gdegbound = fmpz_mpoly_degree_si(A, 0, ctx);
@@ -186,61 +259,82 @@ outer_loop:
 
 inner_loop:
 
-    if (p >= UWORD_MAX_PRIME)
+    /* pick the primes of the next batch of images */
+    for (k = 0; k < num_images; k++)
+    {
+        do {
+            if (p >= UWORD_MAX_PRIME)
+                break;
+            p = n_nextprime(p, 1);
+            /* make sure mod p reduction does not kill both lc(A) and lc(B) */
+        } while (fmpz_fdiv_ui(gamma, p) == 0);
+
+        if (p >= UWORD_MAX_PRIME)
+            break;
+
+        images[k].p = p;
+    }
+
+    if (k < 1)
     {
         /* ran out of primes: absolute failure */
         success = 0;
         goto cleanup;
     }
-    p = n_nextprime(p, 1);
 
-    nmod_mpoly_ctx_change_modulus(ctxp, p);
+    arg->images = images;
+    arg->Gp = Gp;
+    arg->Gmarks = Gmarks;
+    arg->perm = perm;
+    arg->req_zip_images = req_zip_images;
+    arg->Gdegbound = Gdegbound;
 
-    /* make sure mod p reduction does not kill both lc(A) and lc(B) */
-    gammap = fmpz_get_nmod(gamma, ctxp->mod);
-    if (gammap == 0)
-        goto inner_loop;
+    flint_parallel_do((do_func_t) _zip_worker, arg, k, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
 
-    /* make sure mod p reduction does not kill either A or B */
-    fmpz_mpoly_interp_reduce_p(Ap, ctxp, A, ctx);
-    fmpz_mpoly_interp_reduce_p(Bp, ctxp, B, ctx);
-    if (Ap->length == 0 || Bp->length == 0)
-        goto inner_loop;
+    /* use the images in order as if they had been computed one at a time */
+    for (j = 0; j < k; j++)
+    {
+        _zip_image_struct * I = images + j;
 
-    success = nmod_mpolyl_gcds_zippel(Gp, Gmarks->coeffs, Gmarks->length,
-                       Ap, Bp, perm, req_zip_images, ctx->minfo->nvars, ctxp,
-                                            state, &Gdegbound, Amarks, Bmarks);
-    if (success == 0)
-        goto outer_loop; /* resets modulus */
+        if (I->success == 0)
+        {
+            Gdegbound = I->Gdegbound;
+            goto outer_loop; /* resets modulus */
+        }
 
-    if (success < 0 || nmod_mpoly_leadcoeff(Gp, ctxp) == 0)
-        goto inner_loop;
+        if (I->success < 0 || nmod_mpoly_leadcoeff(I->Gp, I->ctxp) == 0)
+            continue;
 
-    t = nmod_div(gammap, nmod_mpoly_leadcoeff(Gp, ctxp), ctxp->mod);
-    nmod_mpoly_scalar_mul_nmod_invertible(Gp, Gp, t, ctxp);
+        gammap = fmpz_get_nmod(gamma, I->ctxp->mod);
+        t = nmod_div(gammap, nmod_mpoly_leadcoeff(I->Gp, I->ctxp),
+                                                                I->ctxp->mod);
+        nmod_mpoly_scalar_mul_nmod_invertible(I->Gp, I->Gp, t, I->ctxp);
 
-    changed = fmpz_mpoly_interp_mcrt_p(&coeffbits, G, ctx, modulus, Gp, ctxp);
-    fmpz_mul_ui(modulus, modulus, p);
+        changed = fmpz_mpoly_interp_mcrt_p(&coeffbits, G, ctx, modulus,
+                                                              I->Gp, I->ctxp);
+        fmpz_mul_ui(modulus, modulus, I->p);
 
-    if (changed)
-    {
-        if (coeffbits > coeffbitbound)
-            goto outer_loop; /* resets modulus */
+        if (changed)
+        {
+            if (coeffbits > coeffbitbound)
+                goto outer_loop; /* resets modulus */
 
-        goto inner_loop;
-    }
+            continue;
+        }
 
-    _fmpz_vec_content(c, G->coeffs, G->length);
-    _fmpz_vec_scalar_divexact_fmpz(G->coeffs, G->coeffs, G->length, c);
+        _fmpz_vec_content(c, G->coeffs, G->length);
+        _fmpz_vec_scalar_divexact_fmpz(G->coeffs, G->coeffs, G->length, c);
 
-    success = fmpz_mpoly_divides(Abar, A, G, ctx) &&
-              fmpz_mpoly_divides(Bbar, B, G, ctx);
+        success = fmpz_mpoly_divides(Abar, A, G, ctx) &&
+                  fmpz_mpoly_divides(Bbar, B, G, ctx);
 
-    if (success)
-        goto cleanup;
+        if (success)
+            goto cleanup;
 
-    /* restore interpolated state */
-    _fmpz_vec_scalar_mul_fmpz(G->coeffs, G->coeffs, G->length, c);
+        /* restore interpolated state */
+        _fmpz_vec_scalar_mul_fmpz(G->coeffs, G->coeffs, G->length, c);
+    }
 
     goto inner_loop;
 
@@ -248,6 +342,18 @@ cleanup:
 
     flint_free(perm);
 
+    for (k = 0; k < num_images; k++)
+    {
+        nmod_mpoly_clear(images[k].Ap, images[k].ctxp);
+        nmod_mpoly_clear(images[k].Bp, images[k].ctxp);
+        nmod_mpoly_clear(images[k].Gp, images[k].ctxp);
+        nmod_mpoly_ctx_clear(images[k].ctxp);
+        n_poly_clear(images[k].Amarks);
+        n_poly_clear(images[k].Bmarks);
+        flint_randclear(images[k].state);
+    }
+    flint_free(images);
+
     n_poly_clear(Amarks);
     n_poly_clear(Bmarks);
     n_poly_clear(Gmarks);
@@ -10,6 +10,94 @@
 */
 
 #include "fmpz_mpoly_factor.h"
+#include "thread_support.h"
+
+/*
+    Evaluation points are tried in batches, one per thread. A trial evaluates
+    A down to a univariate, checks that no degree drops and factors the
+    univariate image. Once a trial finds a squarefree image, the later
+    trials in the batch are abandoned since the earliest usable one is taken.
+*/
+typedef struct
+{
+    fmpz * alpha;
+    fmpz_mpoly_struct * Aevals;
+    fmpz_poly_factor_t Aufac;
+    int good;
+}
+_wang_trial_struct;
+
+typedef struct
+{
+#if FLINT_USES_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+    volatile slong first;
+    _wang_trial_struct * trials;
+    const fmpz_mpoly_struct * A;
+    const slong * degs;
+    const fmpz_mpoly_ctx_struct * ctx;
+}
+_wang_arg_t;
+
+static void _wang_trial_worker(slong k, _wang_arg_t * arg)
+{
+    const fmpz_mpoly_ctx_struct * ctx = arg->ctx;
+    const slong n = ctx->minfo->nvars - 1;
+    _wang_trial_struct * T = arg->trials + k;
+    slong i, j, * tdegs;
+    fmpz_poly_t Au;
+
+    T->good = 0;
+
+    tdegs = FLINT_ARRAY_ALLOC(n + 1, slong);
+
+    /* ensure degrees do not drop under evaluation */
+    for (i = n - 1; i >= 0; i--)
+    {
+        if (arg->first < k)
+            goto cleanup;
+
+        fmpz_mpoly_evaluate_one_fmpz(T->Aevals + i, i == n - 1 ? arg->A :
+                                    T->Aevals + i + 1, i + 1, T->alpha + i, ctx);
+        fmpz_mpoly_degrees_si(tdegs, T->Aevals + i, ctx);
+        for (j = 0; j <= i; j++)
+        {
+            if (tdegs[j] != arg->degs[j])
+                goto cleanup;
+        }
+    }
+
+    if (arg->first < k)
+        goto cleanup;
+
+    FLINT_ASSERT(fmpz_mpoly_is_fmpz_poly(T->Aevals + 0, 0, ctx));
+    fmpz_poly_init(Au);
+    fmpz_mpoly_get_fmpz_poly(Au, T->Aevals + 0, 0, ctx);
+    fmpz_poly_factor(T->Aufac, Au);
+    fmpz_poly_clear(Au);
+
+    T->good = 1;
+
+    for (j = 0; j < T->Aufac->num; j++)
+    {
+        if (T->Aufac->exp[j] != 1)
+            goto cleanup;
+    }
+
+#if FLINT_USES_PTHREAD
+    pthread_mutex_lock(&arg->mutex);
+#endif
+    if (k < arg->first)
+        arg->first = k;
+#if FLINT_USES_PTHREAD
+    pthread_mutex_unlock(&arg->mutex);
+#endif
+
+cleanup:
+
+    flint_free(tdegs);
+}
 
 
 int fmpz_mpoly_factor_irred_wang(
@@ -33,8 +121,11 @@ int fmpz_mpoly_factor_irred_wang(
     fmpz_mpolyv_t tfac;
     fmpz_mpoly_t t, Acopy;
     fmpz_mpoly_struct * newA;
-    fmpz_poly_t Au;
-    fmpz_poly_factor_t Aufac;
+    fmpz_poly_factor_struct * Aufac;
+    slong num_trials = flint_get_num_threads();
+    slong batch;
+    _wang_trial_struct * trials;
+    _wang_arg_t arg[1];
     fmpz_mpoly_t m, mpow;
     fmpz_mpolyv_t new_lcs, lc_divs;
     fmpz_t q;
@@ -53,15 +144,26 @@ int fmpz_mpoly_factor_irred_wang(
     fmpz_mpolyv_init(new_lcs, ctx);
     fmpz_mpolyv_init(lc_divs, ctx);
 
-    fmpz_poly_factor_init(Aufac);
-    fmpz_poly_init(Au);
-
     degs  = (slong *) flint_malloc(2*(n + 1)*sizeof(slong));
     tdegs = degs + (n + 1);
-    alpha = _fmpz_vec_init(n);
-    Aevals    = (fmpz_mpoly_struct *) flint_malloc(n*sizeof(fmpz_mpoly_struct));
-    for (i = 0; i < n; i++)
-        fmpz_mpoly_init(Aevals + i, ctx);
+
+    trials = FLINT_ARRAY_ALLOC(num_trials, _wang_trial_struct);
+    for (k = 0; k < num_trials; k++)
+    {
+        trials[k].alpha = _fmpz_vec_init(n);
+        trials[k].Aevals = FLINT_ARRAY_ALLOC(n, fmpz_mpoly_struct);
+        for (i = 0; i < n; i++)
+            fmpz_mpoly_init(trials[k].Aevals + i, ctx);
+        fmpz_poly_factor_init(trials[k].Aufac);
+    }
+
+#if FLINT_USES_PTHREAD
+    pthread_mutex_init(&arg->mutex, NULL);
+#endif
+    arg->trials = trials;
+    arg->A = A;
+    arg->degs = degs;
+    arg->ctx = ctx;
 
     fmpz_mpolyv_init(tfac, ctx);
     fmpz_mpoly_init(t, ctx);
@@ -72,6 +174,7 @@ int fmpz_mpoly_factor_irred_wang(
 
     alpha_count = 0;
     alpha_modulus = 1;
+    batch = 1;
     goto got_alpha;
 
 next_alpha:
@@ -82,20 +185,29 @@ next_alpha:
         goto cleanup;
     }
 
-    alpha_count++;
-    if (alpha_count >= alpha_modulus)
+    /* check the cap before every point so that a later call also fails */
+    for (batch = 0; batch < num_trials; batch++)
     {
-        alpha_count = 0;
-        alpha_modulus++;
-        if (alpha_modulus/1024 > ctx->minfo->nvars)
+        alpha_count++;
+        if (alpha_count >= alpha_modulus)
         {
-            success = 0;
-            goto cleanup;
+            alpha_count = 0;
+            alpha_modulus++;
         }
+
+        if (alpha_modulus/1024 > ctx->minfo->nvars)
+            break;
+
+        for (i = 0; i < n; i++)
+            fmpz_set_si(trials[batch].alpha + i,
+                         n_urandint(state, alpha_modulus) - alpha_modulus/2);
     }
 
-    for (i = 0; i < n; i++)
-        fmpz_set_si(alpha + i, n_urandint(state, alpha_modulus) - alpha_modulus/2);
+    if (batch < 1)
+    {
+        success = 0;
+        goto cleanup;
+    }
 
 got_alpha:
 
@@ -105,48 +217,53 @@ got_alpha:
         FLINT_ASSERT(degs[i] == tdegs[i]);
 #endif
 
-    /* ensure degrees do not drop under evaluation */
-    for (i = n - 1; i >= 0; i--)
+    arg->first = batch;
+    flint_parallel_do((do_func_t) _wang_trial_worker, arg, batch, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+
+    /* take the first trial with a squarefree univariate image */
+    for (k = 0; k < batch; k++)
     {
-        fmpz_mpoly_evaluate_one_fmpz(Aevals + i,
-                       i == n - 1 ? A : Aevals + i + 1, i + 1, alpha + i, ctx);
-        fmpz_mpoly_degrees_si(tdegs, Aevals + i, ctx);
-        for (j = 0; j <= i; j++)
-        {
-            if (tdegs[j] != degs[j])
-                goto next_alpha;
-        }
-    }
+        if (!trials[k].good)
+            continue;
 
-    /* make sure our univar is squarefree */
-    FLINT_ASSERT(fmpz_mpoly_is_fmpz_poly(Aevals + 0, 0, ctx));
-    success = fmpz_mpoly_get_fmpz_poly(Au, Aevals + 0, 0, ctx);
-    FLINT_ASSERT(success);
-    fmpz_poly_factor(Aufac, Au);
-    r = Aufac->num;
+        Aufac = trials[k].Aufac;
+        r = Aufac->num;
 
-    zassenhaus_prune_start_add_factors(zas);
-    for (j = 0; j < r; j++)
-        zassenhaus_prune_add_factor(zas, fmpz_poly_degree(Aufac->p + j),
+        zassenhaus_prune_start_add_factors(zas);
+        for (j = 0; j < r; j++)
+            zassenhaus_prune_add_factor(zas, fmpz_poly_degree(Aufac->p + j),
                                                                 Aufac->exp[j]);
-    zassenhaus_prune_end_add_factors(zas);
+        zassenhaus_prune_end_add_factors(zas);
 
-    if ((r < 2 && Aufac->exp[0] == 1) ||
-        zassenhaus_prune_must_be_irreducible(zas))
-    {
-        fmpz_mpolyv_fit_length(fac, 1, ctx);
-        fac->length = 1;
-        fmpz_mpoly_set(fac->coeffs + 0, A, ctx);
-        success = 1;
-        goto cleanup;
-    }
+        if ((r < 2 && Aufac->exp[0] == 1) ||
+            zassenhaus_prune_must_be_irreducible(zas))
+        {
+            fmpz_mpolyv_fit_length(fac, 1, ctx);
+            fac->length = 1;
+            fmpz_mpoly_set(fac->coeffs + 0, A, ctx);
+            success = 1;
+            goto cleanup;
+        }
 
-    for (j = 0; j < r; j++)
-    {
-        if (Aufac->exp[j] != 1)
-            goto next_alpha;
+        for (j = 0; j < r; j++)
+        {
+            if (Aufac->exp[j] != 1)
+                break;
+        }
+
+        if (j >= r)
+            break;
     }
 
+    if (k >= batch)
+        goto next_alpha;
+
+    alpha = trials[k].alpha;
+    Aevals = trials[k].Aevals;
+    Aufac = trials[k].Aufac;
+    r = Aufac->num;
+
     fmpz_mpolyv_fit_length(lc_divs, r, ctx);
     lc_divs->length = r;
     if (lcAfac->num > 0)
@@ -298,13 +415,19 @@ cleanup:
     fmpz_mpolyv_clear(new_lcs, ctx);
     fmpz_mpolyv_clear(lc_divs, ctx);
 
-    fmpz_poly_factor_clear(Aufac);
-        
-    _fmpz_vec_clear(alpha, n);
+    for (k = 0; k < num_trials; k++)
+    {
+        _fmpz_vec_clear(trials[k].alpha, n);
+        for (i = 0; i < n; i++)
+            fmpz_mpoly_clear(trials[k].Aevals + i, ctx);
+        flint_free(trials[k].Aevals);
+        fmpz_poly_factor_clear(trials[k].Aufac);
+    }
+    flint_free(trials);
 
-    for (i = 0; i < n; i++)
-        fmpz_mpoly_clear(Aevals + i, ctx);
-    flint_free(Aevals);
+#if FLINT_USES_PTHREAD
+    pthread_mutex_destroy(&arg->mutex);
+#endif
 
     flint_free(degs); /* and tdegs */
     fmpz_mpolyv_clear(tfac, ctx);
@@ -314,8 +437,6 @@ cleanup:
     fmpz_mpoly_clear(m, ctx);
     fmpz_mpoly_clear(mpow, ctx);
 
-    fmpz_poly_clear(Au);
-
 #if FLINT_WANT_ASSERT
     if (success)
     {
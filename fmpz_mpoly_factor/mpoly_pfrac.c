@@ -10,6 +10,46 @@
 */
 
 #include "fmpz_mpoly_factor.h"
+#include "thread_support.h"
+
+/*
+    The products of the betas in the precomputation and the products of the
+    lifted deltas in each step are independent and computed on threads.
+*/
+typedef struct
+{
+    fmpz_mpoly_struct * prods;
+    const fmpz_mpoly_struct ** a;
+    const fmpz_mpoly_struct ** b;
+    fmpz_mpoly_pfrac_struct * I;
+    const fmpz_mpoly_ctx_struct * ctx;
+}
+_pfrac_arg_t;
+
+static void _prod_mbetas_worker(slong ij, _pfrac_arg_t * arg)
+{
+    fmpz_mpoly_pfrac_struct * I = arg->I;
+    const fmpz_mpoly_ctx_struct * ctx = arg->ctx;
+    slong r = I->r, i = ij/r, j = ij%r, k;
+
+    fmpz_mpoly_one(I->prod_mbetas + i*r + j, ctx);
+    for (k = 0; k < r; k++)
+    {
+        if (k == j)
+            continue;
+        fmpz_mpoly_mul(I->prod_mbetas + i*r + j,
+                           I->prod_mbetas + i*r + j, I->mbetas + i*r + k, ctx);
+    }
+
+    if (i > 0)
+        fmpz_mpoly_to_mpolyv(I->prod_mbetas_coeffs + i*r + j,
+                                 I->prod_mbetas + i*r + j, I->xalpha + i, ctx);
+}
+
+static void _mul_worker(slong i, _pfrac_arg_t * arg)
+{
+    fmpz_mpoly_mul(arg->prods + i, arg->a[i], arg->b[i], arg->ctx);
+}
 
 
 int fmpz_mpoly_pfrac_init(
@@ -23,6 +63,7 @@ int fmpz_mpoly_pfrac_init(
 {
     slong success = 1;
     slong i, j, k;
+    _pfrac_arg_t arg[1];
 
     FLINT_ASSERT(bits <= FLINT_BITS);
 
@@ -82,28 +123,17 @@ int fmpz_mpoly_pfrac_init(
     }
 
     /* set product of betas */
-    for (i = w; i >= 0; i--)
+    for (k = 0; k < (w + 1)*r; k++)
     {
-        for (j = 0; j < r; j++)
-        {
-            fmpz_mpoly_init(I->prod_mbetas + i*r + j, ctx);
-            fmpz_mpoly_one(I->prod_mbetas + i*r + j, ctx);
-            for (k = 0; k < r; k++)
-            {
-                if (k == j)
-                    continue;
-                fmpz_mpoly_mul(I->prod_mbetas + i*r + j,
-                           I->prod_mbetas + i*r + j, I->mbetas + i*r + k, ctx);
-            }
-            fmpz_mpolyv_init(I->prod_mbetas_coeffs + i*r + j, ctx);
-            if (i > 0)
-            {
-                fmpz_mpoly_to_mpolyv(I->prod_mbetas_coeffs + i*r + j,
-                                 I->prod_mbetas + i*r + j, I->xalpha + i, ctx);
-            }
-        }        
+        fmpz_mpoly_init(I->prod_mbetas + k, ctx);
+        fmpz_mpolyv_init(I->prod_mbetas_coeffs + k, ctx);
     }
 
+    arg->I = I;
+    arg->ctx = ctx;
+    flint_parallel_do((do_func_t) _prod_mbetas_worker, arg, (w + 1)*r, 0,
+                                                        FLINT_PARALLEL_DYNAMIC);
+
     fmpz_poly_pfrac_init(I->uni_pfrac);
     fmpz_poly_init(I->uni_a);
     I->uni_c = FLINT_ARRAY_ALLOC(r, fmpz_poly_struct);
@@ -182,7 +212,11 @@ int fmpz_mpoly_pfrac(
     const fmpz_mpoly_ctx_t ctx)
 {
     int success, use_U;
-    slong i, j, k, Ui;
+    slong i, j, k, Ui, np;
+    slong num_threads = flint_get_num_threads();
+    fmpz_mpoly_struct * prods = NULL;
+    const fmpz_mpoly_struct ** ab = NULL;
+    _pfrac_arg_t arg[1];
     fmpz_mpoly_struct * deltas = I->deltas + l*I->r;
     fmpz_mpoly_struct * newdeltas = I->deltas + (l - 1)*I->r;
     fmpz_mpoly_struct * q = I->q + l;
@@ -213,6 +247,18 @@ int fmpz_mpoly_pfrac(
     for (i = 0; i < I->r; i++)
         delta_coeffs[i].length = 0;
 
+    if (num_threads > 1 && degs[l] > 0 && I->r > 1)
+    {
+        prods = FLINT_ARRAY_ALLOC(degs[l]*I->r, fmpz_mpoly_struct);
+        ab = FLINT_ARRAY_ALLOC(2*degs[l]*I->r, const fmpz_mpoly_struct *);
+        for (i = 0; i < degs[l]*I->r; i++)
+            fmpz_mpoly_init(prods + i, ctx);
+        arg->prods = prods;
+        arg->a = ab;
+        arg->b = ab + degs[l]*I->r;
+        arg->ctx = ctx;
+    }
+
     use_U = I->xalpha[l].length == 1;
     if (use_U)
         fmpz_mpoly_to_univar(U, t, l, ctx);
@@ -239,6 +285,7 @@ int fmpz_mpoly_pfrac(
             fmpz_mpoly_geobucket_set(G, newt, ctx);
         }
 
+        np = 0;
         for (j = 0; j < k; j++)
         for (i = 0; i < I->r; i++)
         {
@@ -247,11 +294,27 @@ int fmpz_mpoly_pfrac(
             if (k - j >= I->prod_mbetas_coeffs[l*I->r + i].length)
                 continue;
 
+            if (prods != NULL)
+            {
+                arg->a[np] = delta_coeffs[i].coeffs + j;
+                arg->b[np] = I->prod_mbetas_coeffs[l*I->r + i].coeffs + k - j;
+                np++;
+                continue;
+            }
+
             fmpz_mpoly_mul(qt, delta_coeffs[i].coeffs + j,
                         I->prod_mbetas_coeffs[l*I->r + i].coeffs + k - j, ctx);
             fmpz_mpoly_geobucket_sub(G, qt, ctx);
         }
 
+        if (np > 0)
+        {
+            flint_parallel_do((do_func_t) _mul_worker, arg, np, 0,
+                                                        FLINT_PARALLEL_DYNAMIC);
+            for (i = 0; i < np; i++)
+                fmpz_mpoly_geobucket_sub(G, prods + i, ctx);
+        }
+
         fmpz_mpoly_geobucket_empty(newt, G, ctx);
 
         if (fmpz_mpoly_is_zero(newt, ctx))
@@ -259,7 +322,7 @@ int fmpz_mpoly_pfrac(
 
         success = fmpz_mpoly_pfrac(l - 1, newt, degs, I, ctx);
         if (success < 1)
-            return success;
+            goto cleanup;
 
         for (i = 0; i < I->r; i++)
         {
@@ -267,7 +330,10 @@ int fmpz_mpoly_pfrac(
                 continue;
 
             if (k + I->prod_mbetas_coeffs[l*I->r + i].length - 1 > degs[l])
-                return 0;
+            {
+                success = 0;
+                goto cleanup;
+            }
 
             fmpz_mpolyv_set_coeff(delta_coeffs + i, k, newdeltas + i, ctx);
         }
@@ -277,6 +343,18 @@ int fmpz_mpoly_pfrac(
         fmpz_mpoly_from_mpolyv(deltas + i, I->bits,
                                          delta_coeffs + i, I->xalpha + l, ctx);
 
-    return 1;
+    success = 1;
+
+cleanup:
+
+    if (prods != NULL)
+    {
+        for (i = 0; i < degs[l]*I->r; i++)
+            fmpz_mpoly_clear(prods + i, ctx);
+        flint_free(prods);
+        flint_free(ab);
+    }
+
+    return success;
 }
 
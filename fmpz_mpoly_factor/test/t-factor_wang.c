@@ -99,6 +99,7 @@ int
 main(void)
 {
     slong i, j, tmul = 20;
+    const slong max_threads = 5;
 
     FLINT_TEST_INIT(state);
 
@@ -147,6 +148,8 @@ main(void)
             }
         }
 
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         check_omega(lower, WORD_MAX, a, ctx);
 
         fmpz_mpoly_clear(t, ctx);
@@ -257,6 +257,7 @@ int
 main(void)
 {
     slong i, j, tmul = 25;
+    const slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("gcd_zippel....");
@@ -452,6 +453,8 @@ main(void)
             fmpz_mpoly_mul(a, a, t, ctx);
             fmpz_mpoly_mul(b, b, t, ctx);
             fmpz_mpoly_randtest_bits(g, state, len, coeff_bits, FLINT_BITS, ctx);
+            flint_set_num_threads(n_randint(state, max_threads) + 1);
+
             gcd_check(g, a, b, t, ctx, i, j, "sparse");
         }
 
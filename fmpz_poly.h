@@ -509,6 +509,21 @@ FLINT_DLL void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong le
 FLINT_DLL void fmpz_poly_mullow_SS(fmpz_poly_t res,
                   const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
+FLINT_DLL slong _fmpz_poly_mul_multi_mod_num_primes(slong bits1,
+                                   slong bits2, slong len1, slong len2);
+
+FLINT_DLL void _fmpz_poly_mul_multi_mod(fmpz * res, const fmpz * poly1,
+                           slong len1, const fmpz * poly2, slong len2);
+
+FLINT_DLL void fmpz_poly_mul_multi_mod(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
+FLINT_DLL void _fmpz_poly_mullow_multi_mod(fmpz * res, const fmpz * poly1,
+                 slong len1, const fmpz * poly2, slong len2, slong n);
+
+FLINT_DLL void fmpz_poly_mullow_multi_mod(fmpz_poly_t res,
+                  const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
+
 FLINT_DLL void _fmpz_poly_mul(fmpz * res, const fmpz * poly1, 
                                   slong len1, const fmpz * poly2, slong len2);
 
@@ -536,13 +551,14 @@ FLINT_DLL void fmpz_poly_mul_SS_precache_init(fmpz_poly_mul_precache_t pre,
 FLINT_DLL void fmpz_poly_mul_precache_clear(fmpz_poly_mul_precache_t pre);
 
 FLINT_DLL void _fmpz_poly_mullow_SS_precache(fmpz * output,
-   const fmpz * input1, slong len1, fmpz_poly_mul_precache_t pre, slong trunc);
+   const fmpz * input1, slong len1, const fmpz_poly_mul_precache_t pre,
+                                                                  slong trunc);
 
 FLINT_DLL void fmpz_poly_mullow_SS_precache(fmpz_poly_t res,
-               const fmpz_poly_t poly1, fmpz_poly_mul_precache_t pre, slong n);
+         const fmpz_poly_t poly1, const fmpz_poly_mul_precache_t pre, slong n);
 
 FMPZ_POLY_INLINE void fmpz_poly_mul_SS_precache(fmpz_poly_t res,
-                         const fmpz_poly_t poly1, fmpz_poly_mul_precache_t pre)
+                   const fmpz_poly_t poly1, const fmpz_poly_mul_precache_t pre)
 {
     fmpz_poly_mullow_SS_precache(res, poly1, pre,
 		                  FLINT_MAX(poly1->length + pre->len2 - 1, 0));
@@ -1054,6 +1070,9 @@ FLINT_DLL void _fmpz_poly_taylor_shift_divconquer(fmpz * poly, const fmpz_t c, s
 FLINT_DLL void fmpz_poly_taylor_shift_divconquer(fmpz_poly_t g, const fmpz_poly_t f,
     const fmpz_t c);
 
+FLINT_DLL void _fmpz_vec_multi_mod_ui_threaded(mp_ptr * residues,
+        fmpz * vec, slong len, mp_srcptr primes, slong num_primes, int crt);
+
 FLINT_DLL void _fmpz_poly_taylor_shift_multi_mod(fmpz * poly, const fmpz_t c, slong n);
 
 FMPZ_POLY_INLINE
@@ -15,7 +15,40 @@
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
+#include "thread_support.h"
 
+typedef struct
+{
+    const fmpz * A;
+    const fmpz * B;
+    slong len1;
+    slong len2;
+    mp_srcptr primes;
+    mp_ptr H;
+    slong * hlen;
+}
+_gcd_worker_arg_t;
+
+/* gcd of A and B modulo the i-th prime */
+static void
+_gcd_worker(slong i, _gcd_worker_arg_t * arg)
+{
+    nmod_t mod;
+    mp_ptr a, b;
+
+    nmod_init(&mod, arg->primes[i]);
+
+    a = _nmod_vec_init(arg->len1 + arg->len2);
+    b = a + arg->len1;
+
+    _fmpz_vec_get_nmod_vec(a, arg->A, arg->len1, mod);
+    _fmpz_vec_get_nmod_vec(b, arg->B, arg->len2, mod);
+
+    arg->hlen[i] = _nmod_poly_gcd(arg->H + i * arg->len2,
+                                       a, arg->len1, b, arg->len2, mod);
+
+    _nmod_vec_clear(a);
+}
 
 void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
@@ -23,11 +56,13 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     flint_bitcnt_t bits1, bits2, nb1, nb2, bits_small, pbits, curr_bits = 0, new_bits;   
     fmpz_t ac, bc, hc, d, g, l, eval_A, eval_B, eval_GCD, modulus;
     fmpz * A, * B, * Q, * lead_A, * lead_B;
-    mp_ptr a, b, h;
+    mp_ptr h, H, primes;
     mp_limb_t p, h_inv, g_mod;
     nmod_t mod;
-    slong i, n, n0, unlucky, hlen, bound;
+    slong i, j, n, n0, unlucky, hlen, bound, batch, nbatch;
+    slong * hlens, * skipped;
     int g_pm1;
+    _gcd_worker_arg_t arg;
 
     fmpz_init(ac);
     fmpz_init(bc);
@@ -126,10 +161,26 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
 
     Q = _fmpz_vec_init(len1);
 
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    h = _nmod_vec_init(len2);
+    /*
+       The gcds modulo p are computed a batch of primes at a time, one prime
+       per thread, and then processed in order. At most one batch is wasted
+       when the loop terminates.
+    */
+    batch = flint_get_num_threads();
+    primes = _nmod_vec_init(batch);
+    H = _nmod_vec_init(batch * len2);
+    hlens = (slong *) flint_malloc(2 * batch * sizeof(slong));
+    skipped = hlens + batch;
+
+    arg.A = A;
+    arg.B = B;
+    arg.len1 = len1;
+    arg.len2 = len2;
+    arg.primes = primes;
+    arg.H = H;
+    arg.hlen = hlens;
+
+    nbatch = j = 0;
 
     /* zero entire output */
     _fmpz_vec_zero(res, len2);
@@ -145,21 +196,34 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
 
     for (;;)
     {
-        /* get new prime and initialise modulus */
-        p = n_nextprime(p, 0);
-        if (fmpz_fdiv_ui(l, p) == 0)
+        if (j == nbatch)
         {
-            unlucky += pbits;
-            continue;
+            /* get new primes, remembering those dividing l */
+            for (nbatch = 0; nbatch < batch; nbatch++)
+            {
+                skipped[nbatch] = 0;
+
+                for (p = n_nextprime(p, 0); fmpz_fdiv_ui(l, p) == 0;
+                                                      p = n_nextprime(p, 0))
+                    skipped[nbatch]++;
+
+                primes[nbatch] = p;
+            }
+
+            /* compute gcds over Z/pZ */
+            flint_parallel_do((do_func_t) _gcd_worker, &arg, nbatch,
+                                                  0, FLINT_PARALLEL_DYNAMIC);
+
+            j = 0;
         }
-        nmod_init(&mod, p);
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
+        unlucky += skipped[j] * pbits;
 
-        /* compute gcd over Z/pZ */
-        hlen = _nmod_poly_gcd(h, a, len1, b, len2, mod);
+        p = primes[j];
+        nmod_init(&mod, p);
+        h = H + j * len2;
+        hlen = hlens[j];
+        j++;
 
         if (hlen == 1) /* gcd is 1 */
         {
@@ -278,9 +342,9 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     fmpz_clear(l); 
     fmpz_clear(hc);
 
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-    _nmod_vec_clear(h); 
+    _nmod_vec_clear(primes);
+    _nmod_vec_clear(H);
+    flint_free(hlens);
 
     /* finally multiply by content */
     _fmpz_vec_scalar_mul_fmpz(res, res, hlen, d);
@@ -15,6 +15,7 @@
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
+#include "fft_tuning.h"
 
 void
 _fmpz_poly_mul_tiny1(fmpz * res, const fmpz * poly1,
@@ -134,7 +135,7 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
         }
     }
 
-    if (len2 < 7)
+    if (len2 < FMPZ_POLY_MUL_CLASSICAL_CUTOFF)
     {
         _fmpz_poly_mul_classical(res, poly1, len1, poly2, len2);
         return;
@@ -143,8 +144,10 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
     limbs1 = (bits1 + FLINT_BITS - 1) / FLINT_BITS;
     limbs2 = (bits2 + FLINT_BITS - 1) / FLINT_BITS;
 
-    if (len1 < 16 && (limbs1 > 12 || limbs2 > 12))
+    if (len1 < FMPZ_POLY_MUL_KARATSUBA_CUTOFF && (limbs1 > 12 || limbs2 > 12))
         _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2);
+    else if (len2 >= FMPZ_POLY_MUL_MULTI_MOD_CUTOFF && limbs1 + limbs2 <= 32)
+        _fmpz_poly_mul_multi_mod(res, poly1, len1, poly2, len2);
     else if (limbs1 + limbs2 <= 8)
         _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
     else if ((limbs1+limbs2)/2048 > len1 + len2)
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_poly.h"
+
+void _fmpz_poly_mul_multi_mod(fmpz * res, const fmpz * poly1, slong len1,
+                                             const fmpz * poly2, slong len2)
+{
+    _fmpz_poly_mullow_multi_mod(res, poly1, len1, poly2, len2,
+                                                           len1 + len2 - 1);
+}
+
+void
+fmpz_poly_mul_multi_mod(fmpz_poly_t res,
+                        const fmpz_poly_t poly1, const fmpz_poly_t poly2)
+{
+    const slong len1 = poly1->length, len2 = poly2->length;
+    slong rlen;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    rlen = len1 + len2 - 1;
+
+    fmpz_poly_fit_length(res, rlen);
+    _fmpz_poly_mul_multi_mod(res->coeffs, poly1->coeffs, len1,
+                                          poly2->coeffs, len2);
+    _fmpz_poly_set_length(res, rlen);
+}
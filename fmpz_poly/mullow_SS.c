@@ -14,6 +14,57 @@
 #include "fft.h"
 #include "fft_tuning.h"
 #include "flint.h"
+#include "thread_support.h"
+
+/*
+    The FFT vectors are only touched for the first time when the inputs are
+    split into them and zero padded, so doing both in parallel spreads their
+    pages over the memory of the threads that will transform them.
+*/
+typedef struct
+{
+    mp_limb_t ** ii;
+    slong start;
+    slong len;
+    slong size;
+    slong nblocks;
+}
+_zero_pad_arg_t;
+
+static void
+_zero_pad_worker(slong b, _zero_pad_arg_t * arg)
+{
+    slong i, i0, i1;
+
+    i0 = arg->start + (b * arg->len) / arg->nblocks;
+    i1 = arg->start + ((b + 1) * arg->len) / arg->nblocks;
+
+    for (i = i0; i < i1; i++)
+        flint_mpn_zero(arg->ii[i], arg->size);
+}
+
+static void
+_fft_zero_pad(mp_limb_t ** ii, slong start, slong stop, slong size)
+{
+    _zero_pad_arg_t arg;
+
+    if (start >= stop)
+        return;
+
+    arg.ii = ii;
+    arg.start = start;
+    arg.len = stop - start;
+    arg.size = size;
+    arg.nblocks = FLINT_MIN(flint_get_num_threads(),
+                            (arg.len * size) / 32768 + 1);
+    arg.nblocks = FLINT_MIN(arg.nblocks, arg.len);
+
+    if (arg.nblocks > 1)
+        flint_parallel_do((do_func_t) _zero_pad_worker, &arg, arg.nblocks,
+                                      arg.nblocks, FLINT_PARALLEL_UNIFORM);
+    else
+        _zero_pad_worker(0, &arg);
+}
 
 void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong len1, 
                const fmpz * input2, slong len2, slong trunc)
@@ -91,14 +142,12 @@ void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong len1,
 
     /* put coefficients into FFT vecs */
     _fmpz_vec_get_fft(ii, input1, limbs, len1);
-    for (i = len1; i < 4*n; i++)
-        flint_mpn_zero(ii[i], limbs + 1);
+    _fft_zero_pad(ii, len1, 4*n, limbs + 1);
 
     if (input1 != input2) 
     {
         _fmpz_vec_get_fft(jj, input2, limbs, len2);
-        for (i = len2; i < 4*n; i++)
-            flint_mpn_zero(jj[i], limbs + 1);
+        _fft_zero_pad(jj, len2, 4*n, limbs + 1);
     }
 
     if (bits1 < WORD(0) || bits2 < WORD(0)) 
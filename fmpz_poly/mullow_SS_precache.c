@@ -98,7 +98,7 @@ void fmpz_poly_mul_precache_clear(fmpz_poly_mul_precache_t pre)
 }
 
 void _fmpz_poly_mullow_SS_precache(fmpz * output, const fmpz * input1,
-                         slong len1, fmpz_poly_mul_precache_t pre, slong trunc)
+                   slong len1, const fmpz_poly_mul_precache_t pre, slong trunc)
 {
     slong len_out;
     slong size, i;
@@ -149,7 +149,7 @@ void _fmpz_poly_mullow_SS_precache(fmpz * output, const fmpz * input1,
 
 void
 fmpz_poly_mullow_SS_precache(fmpz_poly_t res,
-                    const fmpz_poly_t poly1, fmpz_poly_mul_precache_t pre, slong n)
+              const fmpz_poly_t poly1, const fmpz_poly_mul_precache_t pre, slong n)
 {
     const slong len1 = poly1->length;
 
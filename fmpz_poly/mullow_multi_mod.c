@@ -0,0 +1,143 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "fmpz_poly.h"
+#include "fft_small.h"
+#include "thread_support.h"
+
+slong _fmpz_poly_mul_multi_mod_num_primes(slong bits1, slong bits2,
+                                                     slong len1, slong len2)
+{
+    slong bits;
+
+    /* bound on the absolute value of the output coefficients, with one
+       extra bit as they are recovered with signed CRT */
+    bits = FLINT_ABS(bits1) + FLINT_ABS(bits2)
+                        + FLINT_BIT_COUNT(FLINT_MIN(len1, len2)) + 1;
+
+    /* every prime has at least FFT_SMALL_PRIME_BITS bits */
+    return (bits + FFT_SMALL_PRIME_BITS - 2) / (FFT_SMALL_PRIME_BITS - 1);
+}
+
+typedef struct
+{
+    mp_ptr * a;
+    mp_ptr * b;
+    mp_ptr * res;
+    slong len1;
+    slong len2;
+    slong len;
+}
+_mullow_prime_arg_t;
+
+static void
+_mullow_prime_worker(slong i, _mullow_prime_arg_t * arg)
+{
+    _fft_small_mullow_prime(arg->res[i], arg->len, arg->a[i], arg->len1,
+                                               arg->b[i], arg->len2, i);
+}
+
+void _fmpz_poly_mullow_multi_mod(fmpz * res, const fmpz * poly1, slong len1,
+                             const fmpz * poly2, slong len2, slong n)
+{
+    slong i, len, num_primes, bits1, bits2;
+    mp_ptr data;
+    mp_ptr * a, * b, * c;
+    int squaring;
+    _mullow_prime_arg_t arg;
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+    squaring = (poly1 == poly2 && len1 == len2);
+    len = FLINT_MIN(n, len1 + len2 - 1);
+
+    bits1 = _fmpz_vec_max_bits(poly1, len1);
+    bits2 = squaring ? bits1 : _fmpz_vec_max_bits(poly2, len2);
+
+    if (bits1 == 0 || bits2 == 0)
+    {
+        _fmpz_vec_zero(res, n);
+        return;
+    }
+
+    num_primes = _fmpz_poly_mul_multi_mod_num_primes(bits1, bits2, len1, len2);
+
+    if (num_primes > FFT_SMALL_NUM_PRIMES ||
+        fft_small_depth(len1 + len2 - 1) > FFT_SMALL_MAX_DEPTH)
+    {
+        _fmpz_poly_mullow_KS(res, poly1, len1, poly2, len2, n);
+        return;
+    }
+
+    a = (mp_ptr *) flint_malloc(3 * num_primes * sizeof(mp_ptr));
+    b = a + num_primes;
+    c = b + num_primes;
+
+    data = (mp_ptr) flint_malloc(num_primes * (len1 +
+                        (squaring ? 0 : len2) + len) * sizeof(mp_limb_t));
+
+    for (i = 0; i < num_primes; i++)
+    {
+        a[i] = data + i * len1;
+        b[i] = squaring ? a[i] : data + num_primes * len1 + i * len2;
+        c[i] = data + num_primes * (len1 + (squaring ? 0 : len2)) + i * len;
+    }
+
+    /* reduce the inputs modulo the primes */
+    _fmpz_vec_multi_mod_ui_threaded(a, (fmpz *) poly1, len1,
+                                         fft_small_primes, num_primes, 0);
+    if (!squaring)
+        _fmpz_vec_multi_mod_ui_threaded(b, (fmpz *) poly2, len2,
+                                         fft_small_primes, num_primes, 0);
+
+    /* one product per prime */
+    arg.a = a;
+    arg.b = b;
+    arg.res = c;
+    arg.len1 = len1;
+    arg.len2 = len2;
+    arg.len = len;
+
+    flint_parallel_do((do_func_t) _mullow_prime_worker, &arg, num_primes, 0,
+                                                      FLINT_PARALLEL_DYNAMIC);
+
+    /* signed CRT */
+    _fmpz_vec_multi_mod_ui_threaded(c, res, len,
+                                         fft_small_primes, num_primes, 1);
+
+    _fmpz_vec_zero(res + len, n - len);
+
+    flint_free(data);
+    flint_free(a);
+}
+
+void
+fmpz_poly_mullow_multi_mod(fmpz_poly_t res,
+                    const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = poly2->length;
+
+    if (len1 == 0 || len2 == 0 || n == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    n = FLINT_MIN(n, len1 + len2 - 1);
+
+    fmpz_poly_fit_length(res, n);
+    _fmpz_poly_mullow_multi_mod(res->coeffs, poly1->coeffs, len1,
+                                            poly2->coeffs, len2, n);
+    _fmpz_poly_set_length(res, n);
+    _fmpz_poly_normalise(res);
+}
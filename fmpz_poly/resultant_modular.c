@@ -15,7 +15,38 @@
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
+#include "thread_support.h"
 
+typedef struct
+{
+    const fmpz * A;
+    const fmpz * B;
+    slong len1;
+    slong len2;
+    mp_srcptr primes;
+    mp_ptr res;
+}
+_resultant_worker_arg_t;
+
+/* resultant of A and B modulo the i-th prime */
+static void
+_resultant_worker(slong i, _resultant_worker_arg_t * arg)
+{
+    nmod_t mod;
+    mp_ptr a, b;
+
+    nmod_init(&mod, arg->primes[i]);
+
+    a = _nmod_vec_init(arg->len1 + arg->len2);
+    b = a + arg->len1;
+
+    _fmpz_vec_get_nmod_vec(a, arg->A, arg->len1, mod);
+    _fmpz_vec_get_nmod_vec(b, arg->B, arg->len2, mod);
+
+    arg->res[i] = _nmod_poly_resultant(a, arg->len1, b, arg->len2, mod);
+
+    _nmod_vec_clear(a);
+}
 
 void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
@@ -26,9 +57,9 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_comb_temp_t comb_temp;
     fmpz_t ac, bc, l, modulus;
     fmpz * A, * B, * lead_A, * lead_B;
-    mp_ptr a, b, rarr, parr;
+    mp_ptr rarr, parr;
     mp_limb_t p;
-    nmod_t mod;
+    _resultant_worker_arg_t arg;
     
     /* special case, one of the polys is a constant */
     if (len2 == 1) /* if len1 == 1 then so does len2 */
@@ -96,29 +127,27 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_set_ui(modulus, 1);
     fmpz_zero(res);
 
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-
     for (i = 0; curr_bits < bound; )
     {
-        /* get new prime and initialise modulus */
+        /* get new prime */
         p = n_nextprime(p, 0);
         if (fmpz_fdiv_ui(l, p) == 0)
             continue;
         
         curr_bits += pbits;
+        parr[i++] = p;
+    }
 
-        nmod_init(&mod, p);
-
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
+    /* compute the resultants over Z/pZ, the primes are independent */
+    arg.A = A;
+    arg.B = B;
+    arg.len1 = len1;
+    arg.len2 = len2;
+    arg.primes = parr;
+    arg.res = rarr;
 
-        /* compute resultant over Z/pZ */
-        parr[i] = p;
-        rarr[i++] = _nmod_poly_resultant(a, len1, b, len2, mod);
-    }
+    flint_parallel_do((do_func_t) _resultant_worker, &arg, num_primes,
+                                                  0, FLINT_PARALLEL_DYNAMIC);
 
     fmpz_comb_init(comb, parr, num_primes);
     fmpz_comb_temp_init(comb_temp, comb);
@@ -129,9 +158,6 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_comb_temp_clear(comb_temp);
     fmpz_comb_clear(comb);
         
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-
     _nmod_vec_clear(parr);
     _nmod_vec_clear(rarr);
     
@@ -15,6 +15,7 @@
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
+#include "fft_tuning.h"
 
 void _fmpz_poly_sqr_tiny1(fmpz * res, const fmpz * poly, slong len)
 {
@@ -139,6 +140,8 @@ void _fmpz_poly_sqr(fmpz * res, const fmpz * poly, slong len)
 
     if (len < 16 && limbs > 12)
         _fmpz_poly_sqr_karatsuba(res, poly, len);
+    else if (len >= FMPZ_POLY_MUL_MULTI_MOD_CUTOFF && limbs <= 16)
+        _fmpz_poly_mul_multi_mod(res, poly, len, poly, len);
     else if (limbs <= 4)
         _fmpz_poly_sqr_KS(res, poly, len);
     else if (limbs/2048 > len)
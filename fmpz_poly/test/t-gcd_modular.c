@@ -33,6 +33,7 @@ int
 main(void)
 {
     int i, result;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
     
     flint_printf("gcd_modular....");
@@ -103,6 +104,8 @@ main(void)
     {
         fmpz_poly_t a, d, f, g, q, r;
 
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         fmpz_poly_init(a);
         fmpz_poly_init(d);
         fmpz_poly_init(f);
@@ -144,6 +147,8 @@ main(void)
     {
         fmpz_poly_t a, d, f, g, q, r;
 
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         fmpz_poly_init(a);
         fmpz_poly_init(d);
         fmpz_poly_init(f);
@@ -0,0 +1,173 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "fft_tuning.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    slong max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_multi_mod....");
+    fflush(stdout);
+
+    /* Check aliasing of a and b */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_randtest(b, state, n_randint(state, 50), 200);
+        fmpz_poly_randtest(c, state, n_randint(state, 50), 200);
+
+        fmpz_poly_mul_multi_mod(a, b, c);
+        fmpz_poly_mul_multi_mod(b, b, c);
+
+        result = (fmpz_poly_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(b), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+    }
+
+    /* Check aliasing of a and c */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_randtest(b, state, n_randint(state, 50), 200);
+        fmpz_poly_randtest(c, state, n_randint(state, 50), 200);
+
+        fmpz_poly_mul_multi_mod(a, b, c);
+        fmpz_poly_mul_multi_mod(c, b, c);
+
+        result = (fmpz_poly_equal(a, c));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(c), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+    }
+
+    /* Compare with mul_KS, including squaring and the fallback for
+       coefficients too large for the available primes */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        flint_bitcnt_t bits;
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+
+        bits = (n_randint(state, 20) == 0) ? 2500 : 300;
+
+        fmpz_poly_randtest(b, state, n_randint(state, 200), bits);
+        if (n_randint(state, 4) == 0)
+            fmpz_poly_set(c, b);
+        else
+            fmpz_poly_randtest(c, state, n_randint(state, 200), bits);
+
+        fmpz_poly_mul_KS(a, b, c);
+        if (fmpz_poly_equal(b, c))
+            fmpz_poly_mul_multi_mod(d, b, b);
+        else
+            fmpz_poly_mul_multi_mod(d, b, c);
+
+        result = (fmpz_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
+    /* Compare with mul_KS, lengths above the multimodular cutoff */
+    for (i = 0; i < 2 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        slong len1, len2;
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+
+        len1 = FMPZ_POLY_MUL_MULTI_MOD_CUTOFF + n_randint(state, 1000);
+        len2 = FMPZ_POLY_MUL_MULTI_MOD_CUTOFF + n_randint(state, 1000);
+        fmpz_poly_randtest(b, state, len1, n_randint(state, 500) + 1);
+        fmpz_poly_randtest(c, state, len2, n_randint(state, 500) + 1);
+
+        fmpz_poly_mul_KS(a, b, c);
+        fmpz_poly_mul(d, b, c);
+
+        result = (fmpz_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL (large):\n");
+            flint_printf("len1 = %wd, len2 = %wd\n", len1, len2);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
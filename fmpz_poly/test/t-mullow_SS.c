@@ -21,6 +21,7 @@ int
 main(void)
 {
     int i, result;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("mullow_SS....");
@@ -131,6 +132,50 @@ main(void)
         fmpz_poly_clear(d);
     }
 
+    /* Compare with mul_KS, large coefficients and threads */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        slong len, trunc;
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+        fmpz_poly_randtest(b, state, n_randint(state, 100), 3000);
+        if (n_randint(state, 4) == 0)
+            fmpz_poly_set(c, b);
+        else
+            fmpz_poly_randtest(c, state, n_randint(state, 100), 3000);
+
+        len = b->length + c->length - 1;
+        trunc = (len <= 0) ? 0 : n_randint(state, b->length + c->length);
+
+        fmpz_poly_mul_KS(a, b, c);
+        fmpz_poly_truncate(a, trunc);
+        if (fmpz_poly_equal(b, c))
+            fmpz_poly_mullow_SS(d, b, b, trunc);
+        else
+            fmpz_poly_mullow_SS(d, b, c, trunc);
+
+        result = (fmpz_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL (threaded):\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
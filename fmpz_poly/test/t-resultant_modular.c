@@ -22,6 +22,7 @@ int
 main(void)
 {
     int i, result;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("resultant_modular....");
@@ -65,6 +66,8 @@ main(void)
         fmpz_t a, b, c, d;
         fmpz_poly_t f, g, h, p;
 
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
         fmpz_init(a);
         fmpz_init(b);
         fmpz_init(c);
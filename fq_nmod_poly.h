@@ -34,6 +34,7 @@
 #define FQ_NMOD_MULLOW_CLASSICAL_CUTOFF 6
 
 #define FQ_NMOD_POLY_HGCD_CUTOFF 25
+#define FQ_NMOD_POLY_HGCD_PARALLEL_CUTOFF 64
 #define FQ_NMOD_POLY_SMALL_GCD_CUTOFF 110
 #define FQ_NMOD_POLY_GCD_CUTOFF 120
 
@@ -736,6 +736,19 @@ FLINT_DLL void TEMPLATE(T, poly_xgcd_euclidean)(TEMPLATE(T, poly_t) G,
                                  const TEMPLATE(T, poly_t) B,
                                  const TEMPLATE(T, ctx_t) ctx);
 
+FLINT_DLL slong _TEMPLATE(T, poly_xgcd_hgcd)(TEMPLATE(T, struct) *G,
+                                  TEMPLATE(T, struct) *S,
+                                  TEMPLATE(T, struct) *T,
+                                  const TEMPLATE(T, struct) *A, slong lenA,
+                                  const TEMPLATE(T, struct) *B, slong lenB,
+                                  const TEMPLATE(T, ctx_t) ctx);
+
+FLINT_DLL void TEMPLATE(T, poly_xgcd_hgcd)(TEMPLATE(T, poly_t) G,
+                                 TEMPLATE(T, poly_t) S, TEMPLATE(T, poly_t) T,
+                                 const TEMPLATE(T, poly_t) A,
+                                 const TEMPLATE(T, poly_t) B,
+                                 const TEMPLATE(T, ctx_t) ctx);
+
 FQ_POLY_TEMPLATES_INLINE slong
 _TEMPLATE(T, poly_xgcd)(TEMPLATE(T, struct) *G,
                         TEMPLATE(T, struct) *S, TEMPLATE(T, struct) *T,
@@ -744,8 +757,11 @@ _TEMPLATE(T, poly_xgcd)(TEMPLATE(T, struct) *G,
                         const TEMPLATE(T, t) invB,
                         const TEMPLATE(T, ctx_t) ctx)
 {
-    return _TEMPLATE(T, poly_xgcd_euclidean)(G, S, T, A, lenA,
-                                             B, lenB, invB, ctx);
+    if (lenB < TEMPLATE(CAP_T, POLY_GCD_CUTOFF))
+        return _TEMPLATE(T, poly_xgcd_euclidean)(G, S, T, A, lenA,
+                                                 B, lenB, invB, ctx);
+    else
+        return _TEMPLATE(T, poly_xgcd_hgcd)(G, S, T, A, lenA, B, lenB, ctx);
 }
 
 
@@ -756,7 +772,10 @@ TEMPLATE(T, poly_xgcd)(TEMPLATE(T, poly_t) G,
                        const TEMPLATE(T, poly_t) B,
                        const TEMPLATE(T, ctx_t) ctx)
 {
-    TEMPLATE(T, poly_xgcd_euclidean)(G, S, T, A, B, ctx);
+    if (FLINT_MIN(A->length, B->length) < TEMPLATE(CAP_T, POLY_GCD_CUTOFF))
+        TEMPLATE(T, poly_xgcd_euclidean)(G, S, T, A, B, ctx);
+    else
+        TEMPLATE(T, poly_xgcd_hgcd)(G, S, T, A, B, ctx);
 }
 
 
@@ -0,0 +1,160 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+int
+main(void)
+{
+    int i, result;
+    slong max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("xgcd_hgcd....");
+    fflush(stdout);
+
+    /* Compare with xgcd_euclidean and check correctness */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+        TEMPLATE(T, poly_t) a, b, f, d, g, s, t, v, w;
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        TEMPLATE(T, poly_init) (a, ctx);
+        TEMPLATE(T, poly_init) (b, ctx);
+        TEMPLATE(T, poly_init) (f, ctx);
+        TEMPLATE(T, poly_init) (d, ctx);
+        TEMPLATE(T, poly_init) (g, ctx);
+        TEMPLATE(T, poly_init) (s, ctx);
+        TEMPLATE(T, poly_init) (t, ctx);
+        TEMPLATE(T, poly_init) (v, ctx);
+        TEMPLATE(T, poly_init) (w, ctx);
+        TEMPLATE(T, poly_randtest) (a, state, n_randint(state, 300), ctx);
+        TEMPLATE(T, poly_randtest) (b, state, n_randint(state, 300), ctx);
+        if (n_randint(state, 2))
+        {
+            TEMPLATE(T, poly_randtest) (f, state, n_randint(state, 50), ctx);
+            TEMPLATE(T, poly_mul) (a, a, f, ctx);
+            TEMPLATE(T, poly_mul) (b, b, f, ctx);
+        }
+
+        TEMPLATE(T, poly_xgcd_euclidean) (d, v, w, a, b, ctx);
+        TEMPLATE(T, poly_xgcd_hgcd) (g, s, t, a, b, ctx);
+
+        result = (TEMPLATE(T, poly_equal) (d, g, ctx) &&
+                  TEMPLATE(T, poly_equal) (s, v, ctx) &&
+                  TEMPLATE(T, poly_equal) (t, w, ctx));
+
+        TEMPLATE(T, poly_mul) (v, s, a, ctx);
+        TEMPLATE(T, poly_mul) (w, t, b, ctx);
+        TEMPLATE(T, poly_add) (w, v, w, ctx);
+
+        result = result && TEMPLATE(T, poly_equal) (g, w, ctx);
+
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            TEMPLATE(T, poly_print_pretty) (a, "x", ctx), flint_printf("\n\n");
+            TEMPLATE(T, poly_print_pretty) (b, "x", ctx), flint_printf("\n\n");
+            TEMPLATE(T, poly_print_pretty) (d, "x", ctx), flint_printf("\n\n");
+            TEMPLATE(T, poly_print_pretty) (g, "x", ctx), flint_printf("\n\n");
+            TEMPLATE(T, poly_print_pretty) (s, "x", ctx), flint_printf("\n\n");
+            TEMPLATE(T, poly_print_pretty) (t, "x", ctx), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        TEMPLATE(T, poly_clear) (a, ctx);
+        TEMPLATE(T, poly_clear) (b, ctx);
+        TEMPLATE(T, poly_clear) (f, ctx);
+        TEMPLATE(T, poly_clear) (d, ctx);
+        TEMPLATE(T, poly_clear) (g, ctx);
+        TEMPLATE(T, poly_clear) (s, ctx);
+        TEMPLATE(T, poly_clear) (t, ctx);
+        TEMPLATE(T, poly_clear) (v, ctx);
+        TEMPLATE(T, poly_clear) (w, ctx);
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    /* test aliasing of the outputs with the inputs */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        TEMPLATE(T, ctx_t) ctx;
+        TEMPLATE(T, poly_t) a, b, g, s, t, v, w, x;
+
+        TEMPLATE(T, ctx_randtest) (ctx, state);
+
+        TEMPLATE(T, poly_init) (a, ctx);
+        TEMPLATE(T, poly_init) (b, ctx);
+        TEMPLATE(T, poly_init) (g, ctx);
+        TEMPLATE(T, poly_init) (s, ctx);
+        TEMPLATE(T, poly_init) (t, ctx);
+        TEMPLATE(T, poly_init) (v, ctx);
+        TEMPLATE(T, poly_init) (w, ctx);
+        TEMPLATE(T, poly_init) (x, ctx);
+        TEMPLATE(T, poly_randtest) (a, state, n_randint(state, 300), ctx);
+        TEMPLATE(T, poly_randtest) (b, state, n_randint(state, 300), ctx);
+
+        TEMPLATE(T, poly_xgcd_hgcd) (g, s, t, a, b, ctx);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                TEMPLATE(T, poly_set) (x, a, ctx);
+                TEMPLATE(T, poly_xgcd_hgcd) (x, v, w, x, b, ctx);
+                break;
+            case 1:
+                TEMPLATE(T, poly_set) (v, a, ctx);
+                TEMPLATE(T, poly_xgcd_hgcd) (x, v, w, v, b, ctx);
+                break;
+            default:
+                TEMPLATE(T, poly_set) (w, b, ctx);
+                TEMPLATE(T, poly_xgcd_hgcd) (x, v, w, a, w, ctx);
+                break;
+        }
+
+        result = (TEMPLATE(T, poly_equal) (g, x, ctx) &&
+                  TEMPLATE(T, poly_equal) (s, v, ctx) &&
+                  TEMPLATE(T, poly_equal) (t, w, ctx));
+
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            TEMPLATE(T, poly_print_pretty) (a, "x", ctx), flint_printf("\n\n");
+            TEMPLATE(T, poly_print_pretty) (b, "x", ctx), flint_printf("\n\n");
+            TEMPLATE(T, poly_print_pretty) (g, "x", ctx), flint_printf("\n\n");
+            TEMPLATE(T, poly_print_pretty) (x, "x", ctx), flint_printf("\n\n");
+            fflush(stdout);
+            flint_abort();
+        }
+
+        TEMPLATE(T, poly_clear) (a, ctx);
+        TEMPLATE(T, poly_clear) (b, ctx);
+        TEMPLATE(T, poly_clear) (g, ctx);
+        TEMPLATE(T, poly_clear) (s, ctx);
+        TEMPLATE(T, poly_clear) (t, ctx);
+        TEMPLATE(T, poly_clear) (v, ctx);
+        TEMPLATE(T, poly_clear) (w, ctx);
+        TEMPLATE(T, poly_clear) (x, ctx);
+        TEMPLATE(T, ctx_clear) (ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
+
+#endif
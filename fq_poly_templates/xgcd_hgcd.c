@@ -0,0 +1,372 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#ifdef T
+
+#include "templates.h"
+
+/*
+    We define a whole bunch of macros here which essentially provide 
+    the TEMPLATE(T, poly) functionality as far as the setting of coefficient 
+    data and lengths is concerned, but which do not do any separate 
+    memory allocation.  None of these macros support aliasing.
+ */
+
+#define __set(B, lenB, A, lenA)                     \
+do {                                                \
+    _TEMPLATE(T, vec_set)((B), (A), (lenA), ctx);   \
+    (lenB) = (lenA);                                \
+} while (0)
+
+#define __add(C, lenC, A, lenA, B, lenB)                        \
+do {                                                            \
+    _TEMPLATE(T, poly_add)((C), (A), (lenA), (B), (lenB), ctx); \
+    (lenC) = FLINT_MAX((lenA), (lenB));                         \
+    TEMPLATE(CAP_T, VEC_NORM)((C), (lenC), ctx);                \
+} while (0)
+
+#define __sub(C, lenC, A, lenA, B, lenB)                        \
+do {                                                            \
+    _TEMPLATE(T, poly_sub)((C), (A), (lenA), (B), (lenB), ctx); \
+    (lenC) = FLINT_MAX((lenA), (lenB));                         \
+    TEMPLATE(CAP_T, VEC_NORM)((C), (lenC), ctx);                \
+} while (0)
+
+#define __mul(C, lenC, A, lenA, B, lenB)                                \
+do {                                                                    \
+    if ((lenA) != 0 && (lenB) != 0)                                     \
+    {                                                                   \
+        if ((lenA) >= (lenB))                                           \
+            _TEMPLATE(T, poly_mul)((C), (A), (lenA), (B), (lenB), ctx); \
+        else                                                            \
+            _TEMPLATE(T, poly_mul)((C), (B), (lenB), (A), (lenA), ctx); \
+        (lenC) = (lenA) + (lenB) - 1;                                   \
+    }                                                                   \
+    else                                                                \
+    {                                                                   \
+        (lenC) = 0;                                                     \
+    }                                                                   \
+} while (0)
+
+#define __divrem(Q, lenQ, R, lenR, A, lenA, B, lenB)                        \
+do {                                                                        \
+    if ((lenA) >= (lenB))                                                   \
+    {                                                                       \
+        TEMPLATE(T, inv)(invB, (B) + (lenB) - 1, ctx);                      \
+        _TEMPLATE(T, poly_divrem)((Q), (R), (A), (lenA), (B), (lenB),       \
+                                                              invB, ctx);   \
+        (lenQ) = (lenA) - (lenB) + 1;                                       \
+        (lenR) = (lenB) - 1;                                                \
+        TEMPLATE(CAP_T, VEC_NORM)((R), (lenR), ctx);                        \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        _TEMPLATE(T, vec_set)((R), (A), (lenA), ctx);                       \
+        (lenQ) = 0;                                                         \
+        (lenR) = (lenA);                                                    \
+    }                                                                       \
+} while (0)
+
+#define __div(Q, lenQ, A, lenA, B, lenB)                                    \
+do {                                                                        \
+    if ((lenA) >= (lenB))                                                   \
+    {                                                                       \
+        TEMPLATE(T, struct) * __t = _TEMPLATE(T, vec_init)((lenA), ctx);    \
+        TEMPLATE(T, inv)(invB, (B) + (lenB) - 1, ctx);                      \
+        _TEMPLATE(T, poly_divrem)((Q), __t, (A), (lenA), (B), (lenB),       \
+                                                              invB, ctx);   \
+        _TEMPLATE(T, vec_clear)(__t, (lenA), ctx);                          \
+        (lenQ) = (lenA) - (lenB) + 1;                                       \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        (lenQ) = 0;                                                         \
+    }                                                                       \
+} while (0)
+
+slong
+_TEMPLATE(T, poly_xgcd_hgcd) (TEMPLATE(T, struct) * G,
+                              TEMPLATE(T, struct) * S,
+                              TEMPLATE(T, struct) * T,
+                              const TEMPLATE(T, struct) * A, slong lenA,
+                              const TEMPLATE(T, struct) * B, slong lenB,
+                              const TEMPLATE(T, ctx_t) ctx)
+{
+    slong cutoff, lenG, lenS, lenT;
+
+    if (fmpz_bits(TEMPLATE(T, ctx_prime) (ctx)) <= 8)
+        cutoff = TEMPLATE(CAP_T, POLY_SMALL_GCD_CUTOFF);
+    else
+        cutoff = TEMPLATE(CAP_T, POLY_GCD_CUTOFF);
+
+    if (lenB == 1)
+    {
+        TEMPLATE(T, set) (G + 0, B + 0, ctx);
+        TEMPLATE(T, one) (T + 0, ctx);
+        lenG = 1;
+        lenS = 0;
+        lenT = 1;
+    }
+    else
+    {
+        slong lenq, lenr, len1 = 2 * lenA;
+        TEMPLATE(T, struct) * q, * r;
+        TEMPLATE(T, t) invB;
+
+        q = _TEMPLATE(T, vec_init) (len1, ctx);
+        r = q + lenA;
+
+        TEMPLATE(T, init) (invB, ctx);
+
+        __divrem(q, lenq, r, lenr, A, lenA, B, lenB);
+
+        if (lenr == 0)
+        {
+            __set(G, lenG, B, lenB);
+            TEMPLATE(T, one) (T + 0, ctx);
+            lenS = 0;
+            lenT = 1;
+        }
+        else
+        {
+            TEMPLATE(T, struct) * h, * j, * v, * w, * R[4], * X;
+            slong lenh, lenj, lenv, lenw, lenR[4], len2;
+            int sgnR;
+
+            lenh = lenj = lenB;
+            lenv = lenw = lenA + lenB - 2;
+            lenR[0] = lenR[1] = lenR[2] = lenR[3] = (lenB + 1) / 2;
+
+            len2 = 2 * lenh + 2 * lenv + 4 * lenR[0];
+            X = _TEMPLATE(T, vec_init) (len2, ctx);
+            h = X;
+            j = h + lenh;
+            v = j + lenj;
+            w = v + lenv;
+            R[0] = w + lenw;
+            R[1] = R[0] + lenR[0];
+            R[2] = R[1] + lenR[1];
+            R[3] = R[2] + lenR[2];
+
+            sgnR = _TEMPLATE(T, poly_hgcd) (R, lenR, h, &lenh, j, &lenj,
+                                                    B, lenB, r, lenr, ctx);
+
+            if (sgnR > 0)
+            {
+                _TEMPLATE(T, poly_neg) (S, R[1], lenR[1], ctx);
+                _TEMPLATE(T, vec_set) (T, R[0], lenR[0], ctx);
+            }
+            else
+            {
+                _TEMPLATE(T, vec_set) (S, R[1], lenR[1], ctx);
+                _TEMPLATE(T, poly_neg) (T, R[0], lenR[0], ctx);
+            }
+            lenS = lenR[1];
+            lenT = lenR[0];
+
+            while (lenj != 0)
+            {
+                __divrem(q, lenq, r, lenr, h, lenh, j, lenj);
+
+                __mul(v, lenv, q, lenq, T, lenT);
+                {
+                    slong l;
+                    _TEMPLATE(T, vec_swap) (S, T, FLINT_MAX(lenS, lenT), ctx);
+                    l = lenS; lenS = lenT; lenT = l;
+                }
+                if (lenr != 0) /* prevent overflow of T on last iteration */
+                    __sub(T, lenT, T, lenT, v, lenv);
+                else /* lenr == 0 */
+                {
+                    __set(G, lenG, j, lenj);
+
+                    goto cofactor;
+                }
+                if (lenj < cutoff)
+                {
+                    TEMPLATE(T, struct) * u0 = R[0], * u1 = R[1];
+                    slong lenu0 = lenr - 1, lenu1 = lenj - 1;
+
+                    TEMPLATE(T, inv) (invB, r + lenr - 1, ctx);
+                    lenG = _TEMPLATE(T, poly_xgcd_euclidean) (G, u0, u1,
+                                              j, lenj, r, lenr, invB, ctx);
+                    TEMPLATE(CAP_T, VEC_NORM) (u0, lenu0, ctx);
+                    TEMPLATE(CAP_T, VEC_NORM) (u1, lenu1, ctx);
+
+                    __mul(v, lenv, S, lenS, u0, lenu0);
+                    __mul(w, lenw, T, lenT, u1, lenu1);
+                    __add(S, lenS, v, lenv, w, lenw);
+
+                    goto cofactor;
+                }
+
+                sgnR = _TEMPLATE(T, poly_hgcd) (R, lenR, h, &lenh, j, &lenj,
+                                                    j, lenj, r, lenr, ctx);
+
+                __mul(v, lenv, R[1], lenR[1], T, lenT);
+                __mul(w, lenw, R[2], lenR[2], S, lenS);
+
+                __mul(q, lenq, S, lenS, R[3], lenR[3]);
+                if (sgnR > 0)
+                    __sub(S, lenS, q, lenq, v, lenv);
+                else
+                    __sub(S, lenS, v, lenv, q, lenq);
+
+                __mul(q, lenq, T, lenT, R[0], lenR[0]);
+                if (sgnR > 0)
+                    __sub(T, lenT, q, lenq, w, lenw);
+                else
+                    __sub(T, lenT, w, lenw, q, lenq);
+            }
+            __set(G, lenG, h, lenh);
+
+            cofactor:
+
+            __mul(v, lenv, S, lenS, A, lenA);
+            __sub(w, lenw, G, lenG, v, lenv);
+            __div(T, lenT, w, lenw, B, lenB);
+
+            _TEMPLATE(T, vec_clear) (X, len2, ctx);
+        }
+
+        _TEMPLATE(T, vec_clear) (q, len1, ctx);
+        TEMPLATE(T, clear) (invB, ctx);
+    }
+
+    _TEMPLATE(T, vec_zero) (S + lenS, lenB - 1 - lenS, ctx);
+    _TEMPLATE(T, vec_zero) (T + lenT, lenA - 1 - lenT, ctx);
+
+    return lenG;
+}
+
+void
+TEMPLATE(T, poly_xgcd_hgcd) (TEMPLATE(T, poly_t) G,
+                             TEMPLATE(T, poly_t) S, TEMPLATE(T, poly_t) T,
+                             const TEMPLATE(T, poly_t) A,
+                             const TEMPLATE(T, poly_t) B,
+                             const TEMPLATE(T, ctx_t) ctx)
+{
+    if (A->length < B->length)
+    {
+        TEMPLATE(T, poly_xgcd_hgcd) (G, T, S, B, A, ctx);
+    }
+    else                        /* lenA >= lenB >= 0 */
+    {
+        const slong lenA = A->length, lenB = B->length;
+        TEMPLATE(T, t) inv;
+
+        TEMPLATE(T, init) (inv, ctx);
+        if (lenA == 0)          /* lenA = lenB = 0 */
+        {
+            TEMPLATE(T, poly_zero) (G, ctx);
+            TEMPLATE(T, poly_zero) (S, ctx);
+            TEMPLATE(T, poly_zero) (T, ctx);
+        }
+        else if (lenB == 0)     /* lenA > lenB = 0 */
+        {
+            TEMPLATE(T, inv) (inv, TEMPLATE(T, poly_lead) (A, ctx), ctx);
+            TEMPLATE3(T, poly_scalar_mul, T) (G, A, inv, ctx);
+            TEMPLATE(T, poly_zero) (T, ctx);
+            TEMPLATE3(T, poly_set, T) (S, inv, ctx);
+        }
+        else if (lenB == 1)     /* lenA >= lenB = 1 */
+        {
+            TEMPLATE(T, inv) (inv, B->coeffs + 0, ctx);
+            TEMPLATE3(T, poly_set, T) (T, inv, ctx);
+            TEMPLATE(T, poly_one) (G, ctx);
+            TEMPLATE(T, poly_zero) (S, ctx);
+        }
+        else                    /* lenA >= lenB >= 2 */
+        {
+            TEMPLATE(T, struct) * g, * s, * t;
+            slong lenG, lenS, lenT;
+
+            if (G == A || G == B)
+            {
+                g = _TEMPLATE(T, vec_init) (lenB, ctx);
+            }
+            else
+            {
+                TEMPLATE(T, poly_fit_length) (G, lenB, ctx);
+                g = G->coeffs;
+            }
+            if (S == A || S == B)
+            {
+                s = _TEMPLATE(T, vec_init) (FLINT_MAX(lenB - 1, 2), ctx);
+            }
+            else
+            {
+                TEMPLATE(T, poly_fit_length) (S, FLINT_MAX(lenB - 1, 2), ctx);
+                s = S->coeffs;
+            }
+            if (T == A || T == B)
+            {
+                t = _TEMPLATE(T, vec_init) (FLINT_MAX(lenA - 1, 2), ctx);
+            }
+            else
+            {
+                TEMPLATE(T, poly_fit_length) (T, FLINT_MAX(lenA - 1, 2), ctx);
+                t = T->coeffs;
+            }
+
+            lenG = _TEMPLATE(T, poly_xgcd_hgcd) (g, s, t, A->coeffs, lenA,
+                                                       B->coeffs, lenB, ctx);
+
+            if (G == A || G == B)
+            {
+                _TEMPLATE(T, vec_clear) (G->coeffs, G->alloc, ctx);
+                G->coeffs = g;
+                G->alloc = lenB;
+                G->length = G->alloc;
+            }
+            if (S == A || S == B)
+            {
+                _TEMPLATE(T, vec_clear) (S->coeffs, S->alloc, ctx);
+                S->coeffs = s;
+                S->alloc = FLINT_MAX(lenB - 1, 2);
+                S->length = S->alloc;
+            }
+            if (T == A || T == B)
+            {
+                _TEMPLATE(T, vec_clear) (T->coeffs, T->alloc, ctx);
+                T->coeffs = t;
+                T->alloc = FLINT_MAX(lenA - 1, 2);
+                T->length = T->alloc;
+            }
+
+            _TEMPLATE(T, poly_set_length) (G, lenG, ctx);
+            lenS = FLINT_MAX(lenB - lenG, 1);
+            lenT = FLINT_MAX(lenA - lenG, 1);
+            TEMPLATE(CAP_T, VEC_NORM) (S->coeffs, lenS, ctx);
+            TEMPLATE(CAP_T, VEC_NORM) (T->coeffs, lenT, ctx);
+            _TEMPLATE(T, poly_set_length) (S, lenS, ctx);
+            _TEMPLATE(T, poly_set_length) (T, lenT, ctx);
+
+            if (!TEMPLATE(T, is_one) (TEMPLATE(T, poly_lead) (G, ctx), ctx))
+            {
+                TEMPLATE(T, inv) (inv, TEMPLATE(T, poly_lead) (G, ctx), ctx);
+                TEMPLATE3(T, poly_scalar_mul, T) (G, G, inv, ctx);
+                TEMPLATE3(T, poly_scalar_mul, T) (S, S, inv, ctx);
+                TEMPLATE3(T, poly_scalar_mul, T) (T, T, inv, ctx);
+            }
+        }
+        TEMPLATE(T, clear) (inv, ctx);
+    }
+}
+
+#undef __set
+#undef __add
+#undef __sub
+#undef __mul
+#undef __divrem
+#undef __div
+
+#endif
@@ -33,6 +33,7 @@
 #define FQ_ZECH_MULLOW_CLASSICAL_CUTOFF 90
 
 #define FQ_ZECH_POLY_HGCD_CUTOFF 35
+#define FQ_ZECH_POLY_HGCD_PARALLEL_CUTOFF 64
 #define FQ_ZECH_POLY_GCD_CUTOFF 96
 #define FQ_ZECH_POLY_SMALL_GCD_CUTOFF 96
 
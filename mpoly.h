@@ -1366,6 +1366,24 @@ FLINT_DLL void mpoly_from_mpolyl_perm_inflate(
     const ulong * shift,
     const ulong * stride);
 
+/* evaluation ****************************************************************/
+
+typedef struct
+{
+    slong nvars;
+    slong length;
+    ulong * exps;   /* distinct exponents of each variable, increasing */
+    slong * starts; /* those of variable j are exps[starts[j], starts[j + 1]) */
+    slong * idx;    /* term i has exponent exps[idx[nvars*i + j]] in var j */
+} mpoly_eval_plan_struct;
+
+typedef mpoly_eval_plan_struct mpoly_eval_plan_t[1];
+
+FLINT_DLL void mpoly_eval_plan_init(mpoly_eval_plan_t P, const ulong * Aexps,
+                     slong Alen, flint_bitcnt_t Abits, const mpoly_ctx_t mctx);
+
+FLINT_DLL void mpoly_eval_plan_clear(mpoly_eval_plan_t P);
+
 /* gcd ***********************************************************************/
 
 #define MPOLY_GCD_USE_HENSEL  1
@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "mpoly.h"
+
+static int _ulong_cmp(const void * a, const void * b)
+{
+    ulong x = *(const ulong *) a, y = *(const ulong *) b;
+    return (x > y) - (x < y);
+}
+
+/*
+    Record, for each variable, the increasing list of the distinct exponents
+    with which it occurs in A, and for each term the positions of its
+    exponents in these lists. The exponents must fit one word.
+*/
+void mpoly_eval_plan_init(mpoly_eval_plan_t P, const ulong * Aexps,
+                      slong Alen, flint_bitcnt_t Abits, const mpoly_ctx_t mctx)
+{
+    slong i, j, k, lo, hi, mid, off, shift;
+    slong nvars = mctx->nvars;
+    slong N = mpoly_words_per_exp_sp(Abits, mctx);
+    ulong mask = (-UWORD(1)) >> (FLINT_BITS - Abits);
+    ulong * e, * d;
+
+    FLINT_ASSERT(Abits <= FLINT_BITS);
+
+    P->nvars = nvars;
+    P->length = Alen;
+    P->exps = (ulong *) flint_malloc((nvars*Alen + 1)*sizeof(ulong));
+    P->starts = (slong *) flint_malloc((nvars + 1)*sizeof(slong));
+    P->idx = (slong *) flint_malloc((nvars*Alen + 1)*sizeof(slong));
+
+    e = (ulong *) flint_malloc((Alen + 1)*sizeof(ulong));
+
+    P->starts[0] = 0;
+    for (j = 0; j < nvars; j++)
+    {
+        mpoly_gen_offset_shift_sp(&off, &shift, j, Abits, mctx);
+
+        for (i = 0; i < Alen; i++)
+            e[i] = (Aexps[N*i + off] >> shift) & mask;
+
+        qsort(e, Alen, sizeof(ulong), _ulong_cmp);
+
+        d = P->exps + P->starts[j];
+        for (i = 0, k = 0; i < Alen; i++)
+            if (k == 0 || d[k - 1] != e[i])
+                d[k++] = e[i];
+
+        P->starts[j + 1] = P->starts[j] + k;
+
+        for (i = 0; i < Alen; i++)
+        {
+            ulong ei = (Aexps[N*i + off] >> shift) & mask;
+
+            lo = 0;
+            hi = k - 1;
+            while (lo < hi)
+            {
+                mid = lo + (hi - lo)/2;
+                if (d[mid] < ei)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+
+            FLINT_ASSERT(d[lo] == ei);
+            P->idx[nvars*i + j] = P->starts[j] + lo;
+        }
+    }
+
+    flint_free(e);
+}
+
+void mpoly_eval_plan_clear(mpoly_eval_plan_t P)
+{
+    flint_free(P->exps);
+    flint_free(P->starts);
+    flint_free(P->idx);
+}
@@ -215,6 +215,8 @@ _nmod_mat_mul_classical_threaded_pool_op(nmod_mat_t D, const nmod_mat_t C,
 FLINT_DLL void nmod_mat_mul_classical_threaded(nmod_mat_t C,
 		                       const nmod_mat_t A, const nmod_mat_t B);
 FLINT_DLL void nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
+FLINT_DLL void _nmod_mat_mul_strassen_cutoff(nmod_mat_t C, const nmod_mat_t A,
+                                   const nmod_mat_t B, slong cutoff);
 
 FLINT_DLL void _nmod_mat_mul_classical_op(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op);
@@ -367,6 +369,7 @@ FLINT_DLL void nmod_mat_solve_triu_classical(nmod_mat_t X, const nmod_mat_t U, c
 FLINT_DLL slong nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_classical(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_classical_delayed(slong * P, nmod_mat_t A, int rank_check);
+FLINT_DLL slong nmod_mat_lu_classical_threaded(slong * P, nmod_mat_t A, int rank_check);
 FLINT_DLL slong nmod_mat_lu_recursive(slong * P, nmod_mat_t A, int rank_check);
 
 /* Nonsingular solving */
@@ -425,6 +428,9 @@ FLINT_DLL void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
 #define NMOD_MAT_SOLVE_TRI_COLS_CUTOFF 64
 
+/* Number of entries above which LU base cases are threaded */
+#define NMOD_MAT_LU_THREADED_CUTOFF 16384
+
 /*
    Suggested initial modulus size for multimodular algorithms. This should
    be chosen so that we get the most number of bits per cycle
@@ -15,6 +15,7 @@
 #include "ulong_extras.h"
 #include "nmod_vec.h"
 #include "nmod_mat.h"
+#include "thread_support.h"
 
 slong 
 nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check)
@@ -49,6 +50,10 @@ nmod_mat_lu(slong * P, nmod_mat_t A, int rank_check)
                 return nmod_mat_lu_recursive(P, A, rank_check);
         }
 
+        if (nrows * ncols >= NMOD_MAT_LU_THREADED_CUTOFF &&
+            flint_get_num_threads() > 1)
+            return nmod_mat_lu_classical_threaded(P, A, rank_check);
+
         nlimbs = _nmod_vec_dot_bound_limbs(n, A->mod);
 
         if (nlimbs <= 1 || (nlimbs == 2 && n >= 12) || (nlimbs == 3 && n >= 20))
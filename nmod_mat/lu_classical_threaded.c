@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "thread_support.h"
+
+/* below this many entries per elimination step, don't bother with threads */
+#define NMOD_MAT_LU_THREADED_STEP_CUTOFF 8192
+
+typedef struct
+{
+    mp_ptr * a;
+    slong row;
+    slong col;
+    slong rank;
+    slong length;
+    mp_limb_t d;
+    nmod_t mod;
+}
+_lu_elim_arg_t;
+
+static void
+_lu_elim_worker(slong k, void * varg)
+{
+    _lu_elim_arg_t * arg = (_lu_elim_arg_t *) varg;
+    mp_ptr * a = arg->a;
+    slong i = arg->row + 1 + k;
+    slong col = arg->col;
+    mp_limb_t e;
+
+    e = nmod_mul(a[i][col], arg->d, arg->mod);
+    if (arg->length != 0)
+        _nmod_vec_scalar_addmul_nmod(a[i] + col + 1,
+            a[arg->row] + col + 1, arg->length, nmod_neg(e, arg->mod), arg->mod);
+
+    a[i][col] = 0;
+    a[i][arg->rank - 1] = e;
+}
+
+slong
+nmod_mat_lu_classical_threaded(slong * P, nmod_mat_t A, int rank_check)
+{
+    mp_limb_t ** a;
+    slong i, m, n, rank, row, col, t;
+    _lu_elim_arg_t arg;
+
+    m = A->r;
+    n = A->c;
+    a = A->rows;
+
+    rank = row = col = 0;
+
+    for (i = 0; i < m; i++)
+        P[i] = i;
+
+    arg.a = a;
+    arg.mod = A->mod;
+
+    while (row < m && col < n)
+    {
+        /* find a pivot */
+        for (i = row; i < m && a[i][col] == 0; i++) ;
+
+        if (i == m)
+        {
+            if (rank_check)
+                return 0;
+            col++;
+            continue;
+        }
+
+        if (i != row)
+        {
+            mp_ptr u = a[i];
+            a[i] = a[row];
+            a[row] = u;
+
+            t = P[i];
+            P[i] = P[row];
+            P[row] = t;
+        }
+
+        rank++;
+
+        arg.row = row;
+        arg.col = col;
+        arg.rank = rank;
+        arg.length = n - col - 1;
+        arg.d = nmod_inv(a[row][col], arg.mod);
+
+        /* the rows below the pivot are eliminated independently */
+        flint_parallel_do(_lu_elim_worker, &arg, m - row - 1,
+            ((m - row - 1) * (arg.length + 1) < NMOD_MAT_LU_THREADED_STEP_CUTOFF)
+                ? 1 : 0, FLINT_PARALLEL_UNIFORM);
+
+        row++;
+        col++;
+    }
+
+    return rank;
+}
@@ -17,6 +17,7 @@
 #include "nmod_mat.h"
 #include "nmod_vec.h"
 #include "thread_support.h"
+#include "fft_tuning.h"
 
 #if FLINT_USES_BLAS
 #include "cblas.h"
@@ -80,14 +81,21 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     }
 
     if (FLINT_BITS == 64 && C->mod.n < 2048)
-        cutoff = 400;
+        cutoff = NMOD_MAT_MUL_STRASSEN_SMALL_CUTOFF;
     else
-        cutoff = 200;
+        cutoff = NMOD_MAT_MUL_STRASSEN_CUTOFF;
 
+    /*
+        with several threads strassen runs on top of the threaded classical
+        products, whose blocks must stay large enough to keep them busy
+    */
     if (flint_num_threads > 1)
-	    nmod_mat_mul_classical_threaded(C, A, B);
-    else if (min_dim < cutoff)
-        nmod_mat_mul_classical(C, A, B);
-    else
+        cutoff *= 2;
+
+    if (min_dim >= cutoff)
         nmod_mat_mul_strassen(C, A, B);
+    else if (flint_num_threads > 1)
+        nmod_mat_mul_classical_threaded(C, A, B);
+    else
+        nmod_mat_mul_classical(C, A, B);
 }
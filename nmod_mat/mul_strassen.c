@@ -16,10 +16,59 @@
 #include "flint.h"
 #include "nmod_vec.h"
 #include "nmod_mat.h"
+#include "fft_tuning.h"
 
+/*
+    The temporaries X1 and X2 of all recursion levels are taken from a
+    single array allocated by the top level call: for n x n matrices this
+    is about 2n^2/3 limbs in total.
+*/
 
-void
-nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+static slong
+_nmod_mat_mul_strassen_scratch(slong a, slong b, slong c, slong cutoff)
+{
+    slong anr = a / 2, anc = b / 2, bnc = c / 2;
+    slong s = anr * FLINT_MAX(bnc, anc) + anc * bnc;
+
+    if (FLINT_MIN(FLINT_MIN(anr, anc), bnc) >= cutoff)
+        s += _nmod_mat_mul_strassen_scratch(anr, anc, bnc, cutoff);
+
+    return s;
+}
+
+static void
+_nmod_mat_scratch_init(nmod_mat_t X, mp_ptr T, slong r, slong c, nmod_t mod)
+{
+    slong i;
+
+    X->entries = T;
+    X->r = r;
+    X->c = c;
+    X->mod = mod;
+    X->rows = (mp_limb_t **) flint_malloc(r * sizeof(mp_limb_t *));
+
+    for (i = 0; i < r; i++)
+        X->rows[i] = T + i * c;
+}
+
+static void
+_nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A,
+                              const nmod_mat_t B, mp_ptr T, slong cutoff);
+
+/* the products of the halves recurse while they are large enough */
+static void
+_nmod_mat_mul_half(nmod_mat_t C, const nmod_mat_t A,
+                               const nmod_mat_t B, mp_ptr T, slong cutoff)
+{
+    if (FLINT_MIN(FLINT_MIN(A->r, A->c), B->c) >= cutoff)
+        _nmod_mat_mul_strassen(C, A, B, T, cutoff);
+    else
+        nmod_mat_mul(C, A, B);
+}
+
+static void
+_nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A,
+                               const nmod_mat_t B, mp_ptr T, slong cutoff)
 {
     slong a, b, c;
     slong anr, anc, bnr, bnc;
@@ -33,12 +82,6 @@ nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     b = A->c;
     c = B->c;
 
-    if (a <= 4 || b <= 4 || c <= 4)
-    {
-        nmod_mat_mul(C, A, B);
-        return;
-    }
-
     anr = a / 2;
     anc = b / 2;
     bnr = anc;
@@ -59,8 +102,10 @@ nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     nmod_mat_window_init(C21, C, anr, 0, 2*anr, bnc);
     nmod_mat_window_init(C22, C, anr, bnc, 2*anr, 2*bnc);
 
-    nmod_mat_init(X1, anr, FLINT_MAX(bnc, anc), A->mod.n);
-    nmod_mat_init(X2, anc, bnc, A->mod.n);
+    _nmod_mat_scratch_init(X1, T, anr, FLINT_MAX(bnc, anc), A->mod);
+    T += anr * FLINT_MAX(bnc, anc);
+    _nmod_mat_scratch_init(X2, T, anc, bnc, A->mod);
+    T += anc * bnc;
 
     X1->c = anc;
 
@@ -73,21 +118,21 @@ nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
 
     nmod_mat_sub(X1, A11, A21);
     nmod_mat_sub(X2, B22, B12);
-    nmod_mat_mul(C21, X1, X2);
+    _nmod_mat_mul_half(C21, X1, X2, T, cutoff);
 
     nmod_mat_add(X1, A21, A22);
     nmod_mat_sub(X2, B12, B11);
-    nmod_mat_mul(C22, X1, X2);
+    _nmod_mat_mul_half(C22, X1, X2, T, cutoff);
 
     nmod_mat_sub(X1, X1, A11);
     nmod_mat_sub(X2, B22, X2);
-    nmod_mat_mul(C12, X1, X2);
+    _nmod_mat_mul_half(C12, X1, X2, T, cutoff);
 
     nmod_mat_sub(X1, A12, X1);
-    nmod_mat_mul(C11, X1, B22);
+    _nmod_mat_mul_half(C11, X1, B22, T, cutoff);
 
     X1->c = bnc;
-    nmod_mat_mul(X1, A11, B11);
+    _nmod_mat_mul_half(X1, A11, B11, T, cutoff);
 
     nmod_mat_add(C12, X1, C12);
     nmod_mat_add(C21, C12, C21);
@@ -95,16 +140,15 @@ nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     nmod_mat_add(C22, C21, C22);
     nmod_mat_add(C12, C12, C11);
     nmod_mat_sub(X2, X2, B21);
-    nmod_mat_mul(C11, A22, X2);
-
-    nmod_mat_clear(X2);
+    _nmod_mat_mul_half(C11, A22, X2, T, cutoff);
 
     nmod_mat_sub(C21, C21, C11);
-    nmod_mat_mul(C11, A12, B21);
+    _nmod_mat_mul_half(C11, A12, B21, T, cutoff);
 
     nmod_mat_add(C11, X1, C11);
 
-    nmod_mat_clear(X1);
+    flint_free(X1->rows);
+    flint_free(X2->rows);
 
     nmod_mat_window_clear(A11);
     nmod_mat_window_clear(A12);
@@ -153,3 +197,43 @@ nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
         nmod_mat_window_clear(Cb);
     }
 }
+
+void
+_nmod_mat_mul_strassen_cutoff(nmod_mat_t C, const nmod_mat_t A,
+                                        const nmod_mat_t B, slong cutoff)
+{
+    mp_ptr T;
+    slong n;
+
+    cutoff = FLINT_MAX(cutoff, 2);
+
+    n = _nmod_mat_mul_strassen_scratch(A->r, A->c, B->c, cutoff);
+    T = (mp_ptr) flint_malloc(n * sizeof(mp_limb_t));
+
+    _nmod_mat_mul_strassen(C, A, B, T, cutoff);
+
+    flint_free(T);
+}
+
+void
+nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    slong cutoff;
+
+    if (A->r <= 4 || A->c <= 4 || B->c <= 4)
+    {
+        nmod_mat_mul(C, A, B);
+        return;
+    }
+
+    /* the same crossover as in nmod_mat_mul */
+    if (FLINT_BITS == 64 && C->mod.n < 2048)
+        cutoff = NMOD_MAT_MUL_STRASSEN_SMALL_CUTOFF;
+    else
+        cutoff = NMOD_MAT_MUL_STRASSEN_CUTOFF;
+
+    if (flint_get_num_threads() > 1)
+        cutoff *= 2;
+
+    _nmod_mat_mul_strassen_cutoff(C, A, B, cutoff);
+}
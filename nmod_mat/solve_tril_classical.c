@@ -14,15 +14,62 @@
 #include "flint.h"
 #include "nmod_mat.h"
 #include "nmod_vec.h"
+#include "thread_support.h"
+
+/* below this many operations, solve serially */
+#define NMOD_MAT_SOLVE_TRI_THREADED_CUTOFF 65536
+
+typedef struct
+{
+    nmod_mat_struct * X;
+    const nmod_mat_struct * L;
+    const nmod_mat_struct * B;
+    mp_srcptr inv;
+    int nlimbs;
+    int unit;
+}
+_solve_tril_arg_t;
+
+/* columns of B are solved independently */
+static void
+_solve_tril_column(slong i, void * varg)
+{
+    _solve_tril_arg_t * arg = (_solve_tril_arg_t *) varg;
+    nmod_mat_struct * X = arg->X;
+    const nmod_mat_struct * L = arg->L;
+    const nmod_mat_struct * B = arg->B;
+    nmod_t mod = L->mod;
+    slong j, n = L->r;
+    mp_ptr tmp;
+    TMP_INIT;
+
+    TMP_START;
+    tmp = TMP_ALLOC(n * sizeof(mp_limb_t));
+
+    for (j = 0; j < n; j++)
+    {
+        mp_limb_t s;
+        s = _nmod_vec_dot(L->rows[j], tmp, j, mod, arg->nlimbs);
+        s = nmod_sub(nmod_mat_entry(B, j, i), s, mod);
+        if (!arg->unit)
+            s = n_mulmod2_preinv(s, arg->inv[j], mod.n, mod.ninv);
+        tmp[j] = s;
+    }
+
+    for (j = 0; j < n; j++)
+        nmod_mat_entry(X, j, i) = tmp[j];
+
+    TMP_END;
+}
 
 void
 nmod_mat_solve_tril_classical(nmod_mat_t X, const nmod_mat_t L,
                                                 const nmod_mat_t B, int unit)
 {
-    int nlimbs;
-    slong i, j, n, m;
+    slong i, n, m;
     nmod_t mod;
-    mp_ptr inv, tmp;
+    mp_ptr inv;
+    _solve_tril_arg_t arg;
 
     n = L->r;
     m = B->c;
@@ -37,29 +84,17 @@ nmod_mat_solve_tril_classical(nmod_mat_t X, const nmod_mat_t L,
     else
         inv = NULL;
 
-    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
-    tmp = _nmod_vec_init(n);
+    arg.X = X;
+    arg.L = L;
+    arg.B = B;
+    arg.inv = inv;
+    arg.nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+    arg.unit = unit;
 
-    for (i = 0; i < m; i++)
-    {
-        for (j = 0; j < n; j++)
-            tmp[j] = nmod_mat_entry(X, j, i);
-
-        for (j = 0; j < n; j++)
-        {
-            mp_limb_t s;
-            s = _nmod_vec_dot(L->rows[j], tmp, j, mod, nlimbs);
-            s = nmod_sub(nmod_mat_entry(B, j, i), s, mod);
-            if (!unit)
-                s = n_mulmod2_preinv(s, inv[j], mod.n, mod.ninv);
-            tmp[j] = s;
-        }
-
-        for (j = 0; j < n; j++)
-            nmod_mat_entry(X, j, i) = tmp[j];
-    }
+    flint_parallel_do(_solve_tril_column, &arg, m,
+        (n * n * m < NMOD_MAT_SOLVE_TRI_THREADED_CUTOFF) ? 1 : 0,
+                                                     FLINT_PARALLEL_UNIFORM);
 
-    _nmod_vec_clear(tmp);
     if (!unit)
         _nmod_vec_clear(inv);
 }
@@ -66,6 +66,45 @@ main(void)
         nmod_mat_clear(D);
     }
 
+    /* several levels of recursion at small, mostly odd, sizes */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C, D;
+        mp_limb_t mod = n_randtest_not_zero(state);
+        slong m, k, n, cutoff;
+
+        m = 2*n_randint(state, 40) + n_randint(state, 4);
+        k = 2*n_randint(state, 40) + n_randint(state, 4);
+        n = 2*n_randint(state, 40) + n_randint(state, 4);
+        cutoff = n_randint(state, 8);
+
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, n, k, mod);
+        nmod_mat_init(C, m, k, mod);
+        nmod_mat_init(D, m, k, mod);
+
+        nmod_mat_randtest(A, state);
+        nmod_mat_randtest(B, state);
+        nmod_mat_randtest(D, state);
+
+        nmod_mat_mul_classical(C, A, B);
+        _nmod_mat_mul_strassen_cutoff(D, A, B, cutoff);
+
+        if (!nmod_mat_equal(C, D))
+        {
+            flint_printf("FAIL: results not equal (cutoff)\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, cutoff = %wd\n",
+                                                            m, k, n, cutoff);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
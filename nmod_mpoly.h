@@ -851,6 +851,15 @@ FLINT_DLL mp_limb_t _nmod_mpoly_eval_all_ui(const mp_limb_t * Acoeffs,
 FLINT_DLL ulong nmod_mpoly_evaluate_all_ui(const nmod_mpoly_t A,
                                const ulong * vals, const nmod_mpoly_ctx_t ctx);
 
+FLINT_DLL void _nmod_mpoly_eval_all_ui_vec(mp_limb_t * evs,
+                    const mp_limb_t * Acoeffs, const ulong * Aexps, slong Alen,
+                    flint_bitcnt_t Abits, const mp_limb_t * alphas,
+                    slong npoints, const mpoly_ctx_t mctx, nmod_t mod);
+
+FLINT_DLL void nmod_mpoly_evaluate_all_ui_vec(ulong * evs,
+                    const nmod_mpoly_t A, const ulong * vals, slong npoints,
+                                                  const nmod_mpoly_ctx_t ctx);
+
 FLINT_DLL void nmod_mpoly_evaluate_one_ui(nmod_mpoly_t A, const nmod_mpoly_t B,
                              slong var, ulong val, const nmod_mpoly_ctx_t ctx);
 
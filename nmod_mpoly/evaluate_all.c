@@ -10,6 +10,109 @@
 */
 
 #include "nmod_mpoly.h"
+#include "thread_support.h"
+
+/* minimum number of terms handed to each thread */
+#define EVAL_TERMS_PER_THREAD 1000
+
+typedef struct
+{
+    mp_limb_t * sums;
+    const mp_limb_t * Acoeffs;
+    const ulong * Aexps;
+    slong Alen;
+    flint_bitcnt_t Abits;
+    slong N;
+    slong nvars;
+    const slong * offsets;
+    const slong * shifts;
+    n_poly_struct * caches;
+    nmod_t mod;
+    slong num_blocks;
+}
+_eval_arg_t;
+
+static mp_limb_t _eval_terms(const _eval_arg_t * arg, slong start, slong stop)
+{
+    slong i, j;
+    slong nvars = arg->nvars, N = arg->N;
+    flint_bitcnt_t Abits = arg->Abits;
+    ulong mask = (Abits <= FLINT_BITS) ? (-UWORD(1)) >> (FLINT_BITS - Abits) : 0;
+    const ulong * Aexps = arg->Aexps;
+    const slong * offsets = arg->offsets, * shifts = arg->shifts;
+    n_poly_struct * caches = arg->caches;
+    nmod_t mod = arg->mod;
+    ulong varexp_sp;
+    fmpz_t varexp_mp;
+    mp_limb_t eval, t;
+
+    fmpz_init(varexp_mp);
+
+    eval = 0;
+    for (i = start; i < stop; i++)
+    {
+        t = arg->Acoeffs[i];
+        if (Abits <= FLINT_BITS)
+        {
+            for (j = 0; j < nvars; j++)
+            {
+                varexp_sp = ((Aexps + N*i)[offsets[j]]>>shifts[j])&mask;
+                t = nmod_pow_cache_mulpow_ui(t, varexp_sp, caches + 3*j + 0,
+                                      caches + 3*j + 1, caches + 3*j + 2, mod);
+            }
+        }
+        else
+        {
+            for (j = 0; j < nvars; j++)
+            {
+                fmpz_set_ui_array(varexp_mp, Aexps + N*i + offsets[j], Abits/FLINT_BITS);
+                t = nmod_pow_cache_mulpow_fmpz(t, varexp_mp, caches + 3*j + 0,
+                                      caches + 3*j + 1, caches + 3*j + 2, mod);
+            }
+        }
+
+        eval = nmod_add(eval, t, mod);
+    }
+
+    fmpz_clear(varexp_mp);
+
+    return eval;
+}
+
+static void _eval_worker(slong b, _eval_arg_t * arg)
+{
+    slong start = (b * arg->Alen) / arg->num_blocks;
+    slong stop = ((b + 1) * arg->Alen) / arg->num_blocks;
+
+    arg->sums[b] = _eval_terms(arg, start, stop);
+}
+
+/*
+    The power caches are filled lazily by the lookups. Before they are shared
+    between threads, fill them up to the degree of each variable so that the
+    lookups of all smaller exponents only read them.
+*/
+static void _eval_warm_caches(const _eval_arg_t * arg, const mpoly_ctx_t mctx)
+{
+    slong j;
+    fmpz * degs = _fmpz_vec_init(arg->nvars);
+    n_poly_struct * caches = arg->caches;
+
+    mpoly_degrees_ffmpz(degs, arg->Aexps, arg->Alen, arg->Abits, mctx);
+
+    for (j = 0; j < arg->nvars; j++)
+    {
+        if (fmpz_cmp_ui(degs + j, 50) >= 0)
+            nmod_pow_cache_mulpow_fmpz(1, degs + j, caches + 3*j + 0,
+                                caches + 3*j + 1, caches + 3*j + 2, arg->mod);
+
+        nmod_pow_cache_mulpow_ui(1, fmpz_cmp_ui(degs + j, 49) > 0 ? 49 :
+                                fmpz_get_ui(degs + j), caches + 3*j + 0,
+                                caches + 3*j + 1, caches + 3*j + 2, arg->mod);
+    }
+
+    _fmpz_vec_clear(degs, arg->nvars);
+}
 
 mp_limb_t _nmod_mpoly_eval_all_ui(
     const mp_limb_t * Acoeffs,
@@ -20,21 +123,16 @@ mp_limb_t _nmod_mpoly_eval_all_ui(
     const mpoly_ctx_t mctx,
     nmod_t mod)
 {
-    slong i, j;
+    slong b, j, num_blocks;
     slong nvars = mctx->nvars;
-    ulong mask = (Abits <= FLINT_BITS) ? (-UWORD(1)) >> (FLINT_BITS - Abits) : 0;
-    slong N = mpoly_words_per_exp(Abits, mctx);
-    ulong varexp_sp;
-    fmpz_t varexp_mp;
     slong * offsets, * shifts;
     n_poly_struct * caches;
     mp_limb_t eval, t;
+    _eval_arg_t arg;
     TMP_INIT;
 
     TMP_START;
 
-    fmpz_init(varexp_mp);
-
     caches = (n_poly_struct *) TMP_ALLOC(3*nvars*sizeof(n_poly_struct));
     offsets = (slong *) TMP_ALLOC(2*nvars*sizeof(slong));
     shifts = offsets + nvars;
@@ -57,33 +155,37 @@ mp_limb_t _nmod_mpoly_eval_all_ui(
                                                           caches + 3*j + 2);
     }
 
-    eval = 0;
-    for (i = 0; i < Alen; i++)
+    arg.Acoeffs = Acoeffs;
+    arg.Aexps = Aexps;
+    arg.Alen = Alen;
+    arg.Abits = Abits;
+    arg.N = mpoly_words_per_exp(Abits, mctx);
+    arg.nvars = nvars;
+    arg.offsets = offsets;
+    arg.shifts = shifts;
+    arg.caches = caches;
+    arg.mod = mod;
+
+    num_blocks = FLINT_MIN(flint_get_num_threads(),
+                                                Alen / EVAL_TERMS_PER_THREAD);
+
+    if (num_blocks <= 1)
     {
-        t = Acoeffs[i];
-        if (Abits <= FLINT_BITS)
-        {
-            for (j = 0; j < nvars; j++)
-            {
-                varexp_sp = ((Aexps + N*i)[offsets[j]]>>shifts[j])&mask;
-                t = nmod_pow_cache_mulpow_ui(t, varexp_sp, caches + 3*j + 0,
-                                      caches + 3*j + 1, caches + 3*j + 2, mod);
-            }
-        }
-        else
-        {
-            for (j = 0; j < nvars; j++)
-            {
-                fmpz_set_ui_array(varexp_mp, Aexps + N*i + offsets[j], Abits/FLINT_BITS);
-                t = nmod_pow_cache_mulpow_fmpz(t, varexp_mp, caches + 3*j + 0,
-                                      caches + 3*j + 1, caches + 3*j + 2, mod);
-            }
-        }
-
-        eval = nmod_add(eval, t, mod);
+        eval = _eval_terms(&arg, 0, Alen);
     }
+    else
+    {
+        _eval_warm_caches(&arg, mctx);
 
-    fmpz_clear(varexp_mp);
+        arg.num_blocks = num_blocks;
+        arg.sums = (mp_limb_t *) TMP_ALLOC(num_blocks*sizeof(mp_limb_t));
+
+        flint_parallel_do((do_func_t) _eval_worker, &arg, num_blocks, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+        eval = 0;
+        for (b = 0; b < num_blocks; b++)
+            eval = nmod_add(eval, arg.sums[b], mod);
+    }
 
     for (j = 0; j < 3*nvars; j++)
         n_poly_clear(caches + j);
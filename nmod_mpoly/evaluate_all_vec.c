@@ -0,0 +1,177 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "nmod_mpoly.h"
+#include "thread_support.h"
+
+/* number of points evaluated together */
+#define EVAL_BLOCK 8
+
+typedef struct
+{
+    mp_limb_t * evs;
+    const mp_limb_t * Acoeffs;
+    const mp_limb_t * alphas;
+    slong npoints;
+    const mpoly_eval_plan_struct * P;
+    nmod_t mod;
+    slong num_chunks;
+}
+_eval_vec_arg_t;
+
+/*
+    evs[p] = A(alphas + nvars*p) for the bl <= EVAL_BLOCK points starting at
+    alphas. The powers of the coordinates are laid out so that those of the
+    points of the block are adjacent, and each term is applied to all points
+    of the block at once.
+*/
+static void _eval_block(mp_limb_t * evs, const mp_limb_t * Acoeffs,
+                        const mp_limb_t * alphas, slong bl,
+                        const mpoly_eval_plan_struct * P, mp_limb_t * pw,
+                        nmod_t mod)
+{
+    slong i, j, k, p;
+    slong nvars = P->nvars;
+    const slong * idx;
+    const mp_limb_t * row;
+    mp_limb_t t[EVAL_BLOCK], a;
+    ulong prev;
+
+    for (j = 0; j < nvars; j++)
+    {
+        for (p = 0; p < bl; p++)
+        {
+            a = alphas[nvars*p + j];
+            if (a >= mod.n)
+                NMOD_RED(a, a, mod);
+
+            t[p] = 1;
+            prev = 0;
+            for (k = P->starts[j]; k < P->starts[j + 1]; k++)
+            {
+                if (P->exps[k] - prev == 1)
+                    t[p] = nmod_mul(t[p], a, mod);
+                else if (P->exps[k] != prev)
+                    t[p] = nmod_mul(t[p], n_powmod2_ui_preinv(a,
+                                   P->exps[k] - prev, mod.n, mod.ninv), mod);
+                prev = P->exps[k];
+                pw[EVAL_BLOCK*k + p] = t[p];
+            }
+        }
+    }
+
+    for (p = 0; p < bl; p++)
+        evs[p] = 0;
+
+    for (i = 0; i < P->length; i++)
+    {
+        idx = P->idx + nvars*i;
+
+        for (p = 0; p < bl; p++)
+            t[p] = Acoeffs[i];
+
+        for (j = 0; j < nvars; j++)
+        {
+            row = pw + EVAL_BLOCK*idx[j];
+            for (p = 0; p < bl; p++)
+                t[p] = nmod_mul(t[p], row[p], mod);
+        }
+
+        for (p = 0; p < bl; p++)
+            evs[p] = nmod_add(evs[p], t[p], mod);
+    }
+}
+
+static void _eval_vec_worker(slong c, _eval_vec_arg_t * arg)
+{
+    slong nvars = arg->P->nvars;
+    slong nblocks = (arg->npoints + EVAL_BLOCK - 1)/EVAL_BLOCK;
+    slong b, start, stop, bl;
+    mp_limb_t * pw;
+
+    start = (c*nblocks)/arg->num_chunks;
+    stop = ((c + 1)*nblocks)/arg->num_chunks;
+
+    pw = (mp_limb_t *) flint_malloc(
+                      (EVAL_BLOCK*arg->P->starts[nvars] + 1)*sizeof(mp_limb_t));
+
+    for (b = start; b < stop; b++)
+    {
+        bl = FLINT_MIN(EVAL_BLOCK, arg->npoints - EVAL_BLOCK*b);
+        _eval_block(arg->evs + EVAL_BLOCK*b, arg->Acoeffs,
+                    arg->alphas + nvars*EVAL_BLOCK*b, bl, arg->P, pw, arg->mod);
+    }
+
+    flint_free(pw);
+}
+
+void _nmod_mpoly_eval_all_ui_vec(
+    mp_limb_t * evs,
+    const mp_limb_t * Acoeffs,
+    const ulong * Aexps,
+    slong Alen,
+    flint_bitcnt_t Abits,
+    const mp_limb_t * alphas,
+    slong npoints,
+    const mpoly_ctx_t mctx,
+    nmod_t mod)
+{
+    slong p, nblocks;
+    mpoly_eval_plan_t P;
+    _eval_vec_arg_t arg;
+
+    if (npoints < 1)
+        return;
+
+    if (Abits > FLINT_BITS)
+    {
+        for (p = 0; p < npoints; p++)
+            evs[p] = _nmod_mpoly_eval_all_ui(Acoeffs, Aexps, Alen, Abits,
+                                              alphas + mctx->nvars*p, mctx, mod);
+        return;
+    }
+
+    mpoly_eval_plan_init(P, Aexps, Alen, Abits, mctx);
+
+    nblocks = (npoints + EVAL_BLOCK - 1)/EVAL_BLOCK;
+
+    arg.evs = evs;
+    arg.Acoeffs = Acoeffs;
+    arg.alphas = alphas;
+    arg.npoints = npoints;
+    arg.P = P;
+    arg.mod = mod;
+    arg.num_chunks = FLINT_MIN(flint_get_num_threads(), nblocks);
+
+    flint_parallel_do((do_func_t) _eval_vec_worker, &arg, arg.num_chunks, 0,
+                                                        FLINT_PARALLEL_UNIFORM);
+
+    mpoly_eval_plan_clear(P);
+}
+
+/* evs[p] = A(vals + nvars*p) for 0 <= p < npoints */
+void nmod_mpoly_evaluate_all_ui_vec(ulong * evs, const nmod_mpoly_t A,
+                                    const ulong * vals, slong npoints,
+                                    const nmod_mpoly_ctx_t ctx)
+{
+    slong p;
+
+    if (nmod_mpoly_is_zero(A, ctx))
+    {
+        for (p = 0; p < npoints; p++)
+            evs[p] = 0;
+        return;
+    }
+
+    _nmod_mpoly_eval_all_ui_vec(evs, A->coeffs, A->exps, A->length, A->bits,
+                                          vals, npoints, ctx->minfo, ctx->mod);
+}
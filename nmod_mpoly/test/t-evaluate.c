@@ -18,6 +18,7 @@ main(void)
 {
     slong i, j, v;
     int tmul = 20;
+    slong max_threads = 5;
     FLINT_TEST_INIT(state);
 
     flint_printf("evaluate....");
@@ -218,6 +219,56 @@ main(void)
         nmod_mpoly_ctx_clear(ctx);
     }
 
+    /* Check evalall_vec matches evalall */
+    for (i = 0; i < tmul * flint_test_multiplier(); i++)
+    {
+        nmod_mpoly_ctx_t ctx;
+        nmod_mpoly_t f;
+        mp_limb_t * vals, * evs;
+        slong p, nvars, len, npoints;
+        flint_bitcnt_t exp_bits;
+        mp_limb_t modulus;
+
+        modulus = n_randint(state, FLINT_BITS - 1) + 1;
+        modulus = n_randbits(state, modulus);
+        nmod_mpoly_ctx_init_rand(ctx, state, 10, modulus);
+        nvars = ctx->minfo->nvars;
+
+        nmod_mpoly_init(f, ctx);
+
+        len = n_randint(state, 200);
+        exp_bits = n_randint(state, 2) ? n_randint(state, 10) + 1 :
+                                         n_randint(state, 200) + 1;
+        npoints = n_randint(state, 50);
+
+        vals = (mp_limb_t *) flint_malloc((nvars*npoints + 1)*sizeof(mp_limb_t));
+        evs = (mp_limb_t *) flint_malloc((npoints + 1)*sizeof(mp_limb_t));
+        for (v = 0; v < nvars*npoints; v++)
+            vals[v] = n_randint(state, 4) ? n_randlimb(state) : n_randint(state, 3);
+
+        nmod_mpoly_randtest_bits(f, state, len, exp_bits, ctx);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+        nmod_mpoly_evaluate_all_ui_vec(evs, f, vals, npoints, ctx);
+
+        for (p = 0; p < npoints; p++)
+        {
+            if (evs[p] != nmod_mpoly_evaluate_all_ui(f, vals + nvars*p, ctx))
+            {
+                printf("FAIL\n");
+                flint_printf("Check evalall_vec matches evalall\ni: %wd  p: %wd\n", i, p);
+                fflush(stdout);
+                flint_abort();
+            }
+        }
+
+        flint_free(vals);
+        flint_free(evs);
+
+        nmod_mpoly_clear(f, ctx);
+        nmod_mpoly_ctx_clear(ctx);
+    }
+
     printf("PASS\n");
     FLINT_TEST_CLEANUP(state);
 
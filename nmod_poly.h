@@ -35,6 +35,7 @@
 #include "ulong_extras.h"
 #include "fmpz.h"
 #include "thread_support.h"
+#include "fft_tuning.h"
 
 #ifdef __cplusplus
     extern "C" {
@@ -47,6 +48,18 @@
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
+/*
+    Minimum length for multiplication via small prime NTTs rather than KS,
+    depending on the number of bits of the modulus and the number of primes.
+    Moduli of 25 to 39 bits needing more than one prime are left to KS.
+    The lengths are set in fft_tuning.h.
+*/
+#define NMOD_POLY_FFT_SMALL_CUTOFF(bits, num_primes)                   \
+    ((num_primes) == 1 ? ((bits) >= 16 ? NMOD_POLY_FFT_SMALL_CUTOFF1 : \
+                          (bits) >= 12 ? 5*NMOD_POLY_FFT_SMALL_CUTOFF1/2 : \
+                                         WORD_MAX) :                   \
+                         ((bits) >= 40 ? NMOD_POLY_FFT_SMALL_CUTOFF2 : WORD_MAX))
+
 NMOD_POLY_INLINE
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
 {
@@ -582,6 +595,18 @@ FLINT_DLL void _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
 FLINT_DLL void nmod_poly_mullow_KS(nmod_poly_t res, const nmod_poly_t poly1, 
                              const nmod_poly_t poly2, flint_bitcnt_t bits, slong n);
 
+FLINT_DLL void _nmod_poly_mul_fft_small(mp_ptr res, mp_srcptr poly1,
+                       slong len1, mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mul_fft_small(nmod_poly_t res,
+                               const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+FLINT_DLL void _nmod_poly_mullow_fft_small(mp_ptr res, mp_srcptr poly1,
+              slong len1, mp_srcptr poly2, slong len2, slong n, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mullow_fft_small(nmod_poly_t res,
+            const nmod_poly_t poly1, const nmod_poly_t poly2, slong n);
+
 FLINT_DLL void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1, 
                                        mp_srcptr poly2, slong len2, nmod_t mod);
 
@@ -15,6 +15,8 @@
 #include "flint.h"
 #include "nmod_vec.h"
 #include "nmod_poly.h"
+#include "fft_small.h"
+#include "fft_tuning.h"
 
 void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1, 
                              mp_srcptr poly2, slong len2, nmod_t mod)
@@ -36,6 +38,11 @@ void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1,
         _nmod_poly_mul_KS(res, poly1, len1, poly2, len2, 0, mod);
     else if (cutoff_len * (bits + 1) * (bits + 1) < 100000)
         _nmod_poly_mul_KS2(res, poly1, len1, poly2, len2, mod);
+#if FLINT64
+    else if (cutoff_len >= NMOD_POLY_FFT_SMALL_CUTOFF(bits,
+                                fft_small_nmod_num_primes(len1, len2, mod)))
+        _nmod_poly_mul_fft_small(res, poly1, len1, poly2, len2, mod);
+#endif
     else
         _nmod_poly_mul_KS4(res, poly1, len1, poly2, len2, mod);
 }
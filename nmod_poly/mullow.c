@@ -15,6 +15,8 @@
 #include "flint.h"
 #include "nmod_vec.h"
 #include "nmod_poly.h"
+#include "fft_small.h"
+#include "fft_tuning.h"
 
 void _nmod_poly_mullow(mp_ptr res, mp_srcptr poly1, slong len1, 
                              mp_srcptr poly2, slong len2, slong n, nmod_t mod)
@@ -34,6 +36,11 @@ void _nmod_poly_mullow(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (n < 10 + bits * bits / 10)
         _nmod_poly_mullow_classical(res, poly1, len1, poly2, len2, n, mod);
+#if FLINT64
+    else if (FLINT_MIN(len1, 2 * len2) >= NMOD_POLY_FFT_SMALL_CUTOFF(bits,
+                                fft_small_nmod_num_primes(len1, len2, mod)))
+        _nmod_poly_mullow_fft_small(res, poly1, len1, poly2, len2, n, mod);
+#endif
     else
         _nmod_poly_mullow_KS(res, poly1, len1, poly2, len2, 0, n, mod);
 }
@@ -0,0 +1,58 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "fft_small.h"
+
+void _nmod_poly_mullow_fft_small(mp_ptr res, mp_srcptr poly1, slong len1,
+                              mp_srcptr poly2, slong len2, slong n, nmod_t mod)
+{
+    _fft_small_mullow_nmod(res, n, poly1, len1, poly2, len2, mod);
+}
+
+void nmod_poly_mullow_fft_small(nmod_poly_t res, const nmod_poly_t poly1,
+                                            const nmod_poly_t poly2, slong n)
+{
+    slong len_out;
+
+    if ((poly1->length == 0) || (poly2->length == 0) || n == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = poly1->length + poly2->length - 1;
+    if (n > len_out)
+        n = len_out;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+        nmod_poly_init2_preinv(temp, poly1->mod.n, poly1->mod.ninv, n);
+        _nmod_poly_mullow_fft_small(temp->coeffs, poly1->coeffs, poly1->length,
+                                 poly2->coeffs, poly2->length, n, poly1->mod);
+        nmod_poly_swap(res, temp);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, n);
+        _nmod_poly_mullow_fft_small(res->coeffs, poly1->coeffs, poly1->length,
+                                 poly2->coeffs, poly2->length, n, poly1->mod);
+    }
+
+    res->length = n;
+    _nmod_poly_normalise(res);
+}
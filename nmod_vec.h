@@ -141,10 +141,12 @@ FLINT_DLL int _nmod_vec_dot_bound_limbs(slong len, nmod_t mod);
             case 2:                                                         \
                 if (mod.n <= (UWORD(1) << (FLINT_BITS / 2)))                \
                 {                                                           \
+                    /* no add_ssaaaa, so that the loop can be vectorised */ \
                     for (i = 0; i < (len); i++)                             \
                     {                                                       \
                         t0 = (expr1) * (expr2);                             \
-                        add_ssaaaa(s1, s0, s1, s0, 0, t0);                  \
+                        s0 += t0;                                           \
+                        s1 += (s0 < t0);                                    \
                     }                                                       \
                 }                                                           \
                 else if ((len) < 8)                                         \
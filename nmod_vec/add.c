@@ -15,6 +15,7 @@
 #include "ulong_extras.h"
 #include "nmod_vec.h"
 
+FLINT_TARGET_CLONES
 void _nmod_vec_add(mp_ptr res, mp_srcptr vec1, 
                    mp_srcptr vec2, slong len, nmod_t mod)
 {
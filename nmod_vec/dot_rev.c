@@ -23,6 +23,7 @@ nmod_fmma(mp_limb_t a, mp_limb_t b, mp_limb_t c, mp_limb_t d, nmod_t mod)
     return a;
 }
 
+FLINT_TARGET_CLONES
 mp_limb_t
 _nmod_vec_dot_rev(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod, int nlimbs)
 {
@@ -42,12 +42,48 @@ void _nmod_vec_scalar_addmul_nmod_generic(mp_ptr res, mp_srcptr vec,
     }
 }
 
+#if FLINT64
+
+/* see _nmod_vec_scalar_mul_nmod_shoup_halfword */
+FLINT_TARGET_CLONES
+static void
+_nmod_vec_scalar_addmul_nmod_shoup_halfword(mp_ptr res, mp_srcptr vec,
+                                     slong len, mp_limb_t c, mp_limb_t n)
+{
+    slong i;
+    unsigned int cc = c, nn = n, w, q;
+    mp_limb_t r;
+
+    w = (c << 32) / n;
+
+    for (i = 0; i < len; i++)
+    {
+        unsigned int a = vec[i];
+        q = ((mp_limb_t) a * w) >> 32;
+        r = (mp_limb_t) a * cc - (mp_limb_t) q * nn;
+        r = (r >= n) ? r - n : r;
+        r += res[i];
+        res[i] = (r >= n) ? r - n : r;
+    }
+}
+
+#endif
+
 void _nmod_vec_scalar_addmul_nmod_shoup(mp_ptr res, mp_srcptr vec, 
 				             slong len, mp_limb_t c, nmod_t mod)
 {
     slong i;
     mp_limb_t t, cinv;
 
+#if FLINT64
+    if (mod.n <= UWORD(0xffffffff))
+    {
+        _nmod_vec_scalar_addmul_nmod_shoup_halfword(res, vec, len, c, mod.n);
+        return;
+    }
+#endif
+
+
     cinv = n_mulmod_precomp_shoup(c, mod.n);
 
     for (i = 0; i < len; i++)
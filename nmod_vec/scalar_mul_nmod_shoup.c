@@ -16,11 +16,52 @@
 #include "ulong_extras.h"
 #include "nmod_vec.h"
 
+#if FLINT64
+
+/*
+   When n < 2^32 the Shoup quotient can be computed from a precomputed
+   w = floor(c 2^32 / n) using only products of 32-bit numbers. These are
+   available as vector instructions, so unlike n_mulmod_shoup, which needs
+   the high word of a full product, this loop vectorises; FLINT_TARGET_CLONES
+   turns the vectoriser on, so this also happens at -O2.
+   The remainder r = a c - q n before correction is less than 2n.
+*/
+FLINT_TARGET_CLONES
+static void
+_nmod_vec_scalar_mul_nmod_shoup_halfword(mp_ptr res, mp_srcptr vec,
+                                     slong len, mp_limb_t c, mp_limb_t n)
+{
+    slong i;
+    unsigned int cc = c, nn = n, w, q;
+    mp_limb_t r;
+
+    w = (c << 32) / n;
+
+    for (i = 0; i < len; i++)
+    {
+        unsigned int a = vec[i];
+        q = ((mp_limb_t) a * w) >> 32;
+        r = (mp_limb_t) a * cc - (mp_limb_t) q * nn;
+        res[i] = (r >= n) ? r - n : r;
+    }
+}
+
+#endif
+
 void _nmod_vec_scalar_mul_nmod_shoup(mp_ptr res, mp_srcptr vec, 
                                slong len, mp_limb_t c, nmod_t mod)
 {
     slong i;
     mp_limb_t w_pr;
+
+#if FLINT64
+    if (mod.n <= UWORD(0xffffffff))
+    {
+        _nmod_vec_scalar_mul_nmod_shoup_halfword(res, vec, len, c, mod.n);
+        return;
+    }
+#endif
+
     w_pr = n_mulmod_precomp_shoup(c, mod.n);
     for (i = 0; i < len; i++)
         res[i] = n_mulmod_shoup(c, vec[i], w_pr, mod.n);
@@ -63,6 +63,50 @@ main(void)
         _nmod_vec_clear(vec3);
     }
 
+#if FLINT64
+    /* Compare with nmod_mul for moduli near the half word boundary */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong j, len = n_randint(state, 100) + 11;
+        mp_limb_t n, c;
+        nmod_t mod;
+        mp_ptr vec, vec2, vec3;
+
+        n = (n_randint(state, 2) ? UWORD(1) << 31 : UWORD(1) << 32)
+                                                   + n_randint(state, 33) - 16;
+        c = n_randint(state, 4) ? n_randint(state, n) : n - 1;
+
+        vec = _nmod_vec_init(len);
+        vec2 = _nmod_vec_init(len);
+        vec3 = _nmod_vec_init(len);
+
+        nmod_init(&mod, n);
+
+        _nmod_vec_randtest(vec, state, len, mod);
+        _nmod_vec_randtest(vec2, state, len, mod);
+        vec[n_randint(state, len)] = n - 1;
+
+        for (j = 0; j < len; j++)
+            vec3[j] = nmod_add(vec2[j], nmod_mul(vec[j], c, mod), mod);
+
+        /* long enough to use the Shoup kernel */
+        _nmod_vec_scalar_addmul_nmod(vec2, vec, len, c, mod);
+
+        result = _nmod_vec_equal(vec2, vec3, len);
+        if (!result)
+        {
+            flint_printf("FAIL (half word):\n");
+            flint_printf("len = %wd, n = %wu, c = %wu\n", len, n, c);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(vec);
+        _nmod_vec_clear(vec2);
+        _nmod_vec_clear(vec3);
+    }
+#endif
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
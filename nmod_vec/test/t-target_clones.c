@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+/*
+    The kernels compiled with FLINT_TARGET_CLONES run whichever clone the
+    host selects. Check them against the scalar functions on all short
+    lengths and on unaligned vectors, so that both the vectorised loops and
+    their tails are exercised, and in place.
+*/
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("target_clones....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        slong i, len, off;
+        nmod_t mod;
+        mp_limb_t n, s1, s2, t;
+        mp_ptr a, b, c, d;
+        int nlimbs;
+
+        len = n_randint(state, 80);
+        off = n_randint(state, 8);
+        n = n_randtest_not_zero(state);
+        nmod_init(&mod, n);
+
+        a = _nmod_vec_init(len + off);
+        b = _nmod_vec_init(len + off);
+        c = _nmod_vec_init(len + off);
+        d = _nmod_vec_init(len + off);
+
+        _nmod_vec_randtest(a + off, state, len, mod);
+        _nmod_vec_randtest(b + off, state, len, mod);
+
+        _nmod_vec_add(c + off, a + off, b + off, len, mod);
+        for (i = 0; i < len; i++)
+            d[off + i] = nmod_add(a[off + i], b[off + i], mod);
+        if (!_nmod_vec_equal(c + off, d + off, len))
+        {
+            flint_printf("FAIL (add)\n");
+            flint_printf("len = %wd, off = %wd, n = %wu\n", len, off, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_set(c + off, a + off, len);
+        _nmod_vec_sub(c + off, c + off, b + off, len, mod);
+        for (i = 0; i < len; i++)
+            d[off + i] = nmod_sub(a[off + i], b[off + i], mod);
+        if (!_nmod_vec_equal(c + off, d + off, len))
+        {
+            flint_printf("FAIL (sub)\n");
+            flint_printf("len = %wd, off = %wd, n = %wu\n", len, off, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_neg(c + off, a + off, len, mod);
+        for (i = 0; i < len; i++)
+            d[off + i] = nmod_neg(a[off + i], mod);
+        if (!_nmod_vec_equal(c + off, d + off, len))
+        {
+            flint_printf("FAIL (neg)\n");
+            flint_printf("len = %wd, off = %wd, n = %wu\n", len, off, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        nlimbs = _nmod_vec_dot_bound_limbs(len, mod);
+
+        s1 = _nmod_vec_dot(a + off, b + off, len, mod, nlimbs);
+        s2 = 0;
+        for (i = 0; i < len; i++)
+        {
+            t = nmod_mul(a[off + i], b[off + i], mod);
+            s2 = nmod_add(s2, t, mod);
+        }
+        if (s1 != s2)
+        {
+            flint_printf("FAIL (dot)\n");
+            flint_printf("len = %wd, off = %wd, n = %wu\n", len, off, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        s1 = _nmod_vec_dot_rev(a + off, b + off, len, mod, nlimbs);
+        s2 = 0;
+        for (i = 0; i < len; i++)
+        {
+            t = nmod_mul(a[off + i], b[off + len - 1 - i], mod);
+            s2 = nmod_add(s2, t, mod);
+        }
+        if (s1 != s2)
+        {
+            flint_printf("FAIL (dot_rev)\n");
+            flint_printf("len = %wd, off = %wd, n = %wu\n", len, off, n);
+            fflush(stdout);
+            flint_abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(c);
+        _nmod_vec_clear(d);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
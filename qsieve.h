@@ -84,6 +84,10 @@ typedef struct qs_poly_s
    slong * small;     /* exponents of small prime factors in relations */
    fac_t * factor;    /* factors for a relation */
    slong num_factors; /* number of factors found in a relation */
+
+   relation_t * rels; /* relations found by this thread, not yet gathered */
+   slong num_rels;
+   slong alloc_rels;
 } qs_poly_s;
 
 typedef qs_poly_s qs_poly_t[1];
@@ -176,8 +180,9 @@ typedef struct qs_s
                        RELATION DATA
    ***************************************************************************/
 
-   FILE * siqs;           /* pointer to file for storing relations */
-   char * fname;          /* name of file used for relations */
+   relation_t * rels;     /* all full and partial relations found so far */
+   slong num_rels;        /* number of relations in rels */
+   slong alloc_rels;      /* space allocated for rels */
 
    slong full_relation;   /* number of full relations */
    slong num_cycles;      /* number of possible full relations from partials */
@@ -359,15 +364,17 @@ FLINT_DLL int qsieve_relations_cmp(const void * a, const void * b);
 
 FLINT_DLL slong qsieve_merge_relations(qs_t qs_inf);
 
-FLINT_DLL void qsieve_write_to_file(qs_t qs_inf, mp_limb_t prime,
-                                                     fmpz_t Y, qs_poly_t poly);
+FLINT_DLL void qsieve_store_relation(qs_t qs_inf, qs_poly_t poly,
+                                                   mp_limb_t prime, fmpz_t Y);
+
+FLINT_DLL void qsieve_gather_relations(qs_t qs_inf);
+
+FLINT_DLL void qsieve_clear_relations(qs_t qs_inf);
 
 FLINT_DLL hash_t * qsieve_get_table_entry(qs_t qs_inf, mp_limb_t prime);
 
 FLINT_DLL void qsieve_add_to_hashtable(qs_t qs_inf, mp_limb_t prime);
 
-FLINT_DLL relation_t qsieve_parse_relation(qs_t qs_inf, char * str);
-
 FLINT_DLL relation_t qsieve_merge_relation(qs_t qs_inf, relation_t  a, relation_t  b);
 
 FLINT_DLL int qsieve_compare_relation(const void * a, const void * b);
@@ -423,6 +430,9 @@ FLINT_DLL uint64_t get_null_entry(uint64_t * nullrows, slong i, slong l);
 
 FLINT_DLL void reduce_matrix(qs_t qs_inf, slong *nrows, slong *ncols, la_col_t *cols);
 
+/* the smallest number of columns for which block_lanczos uses threads */
+#define QS_LANCZOS_THREAD_CUTOFF 1000
+
 FLINT_DLL uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 			slong dense_rows, slong ncols, la_col_t *B);
 
@@ -22,6 +22,7 @@ benefit from your work.
 
 
 #include "qsieve.h"
+#include "thread_support.h"
 
 #define BIT(x) (((uint64_t)(1)) << (x))
 
@@ -246,20 +247,15 @@ static void precompute_Nx64_64x64(uint64_t *x, uint64_t *c) {
 }
 
 /*-------------------------------------------------------------------*/
-static void mul_Nx64_64x64_acc(uint64_t *v, uint64_t *x, uint64_t *c, 
+static void mul_Nx64_64x64_acc_precomp(uint64_t *v, uint64_t *c,
 				uint64_t *y, slong n) {
 
-	/* let v[][] be a n x 64 matrix with elements in GF(2), 
-	   represented as an array of n 64-bit words. Let c[][]
-	   be an 8 x 256 scratch matrix of 64-bit words.
-	   This code multiplies v[][] by the 64x64 matrix 
-	   x[][], then XORs the n x 64 result into y[][] */
+	/* as mul_Nx64_64x64_acc below, but with the table
+	   c[][] already filled in by precompute_Nx64_64x64 */
 
-    slong i;
+	slong i;
 	uint64_t word;
 
-	precompute_Nx64_64x64(x, c);
-
 	for (i = 0; i < n; i++) {
 		word = v[i];
 		y[i] ^=  c[ 0*256 + ((word>> 0) & 0xff) ]
@@ -273,6 +269,20 @@ static void mul_Nx64_64x64_acc(uint64_t *v, uint64_t *x, uint64_t *c,
 	}
 }
 
+/*-------------------------------------------------------------------*/
+static void mul_Nx64_64x64_acc(uint64_t *v, uint64_t *x, uint64_t *c, 
+				uint64_t *y, slong n) {
+
+	/* let v[][] be a n x 64 matrix with elements in GF(2), 
+	   represented as an array of n 64-bit words. Let c[][]
+	   be an 8 x 256 scratch matrix of 64-bit words.
+	   This code multiplies v[][] by the 64x64 matrix 
+	   x[][], then XORs the n x 64 result into y[][] */
+
+	precompute_Nx64_64x64(x, c);
+	mul_Nx64_64x64_acc_precomp(v, c, y, n);
+}
+
 /*-------------------------------------------------------------------*/
 static void mul_64xN_Nx64(uint64_t *x, uint64_t *y,
 			   uint64_t *c, uint64_t *xy, slong n) {
@@ -475,20 +485,16 @@ static slong find_nonsingular_sub(uint64_t *t, slong *s,
 }
 
 /*-------------------------------------------------------------------*/
-void mul_MxN_Nx64(slong vsize, slong dense_rows,
-		slong ncols, la_col_t *A,
-		uint64_t *x, uint64_t *b) {
+static void mul_MxN_Nx64_range(slong dense_rows, slong start,
+		slong stop, la_col_t *A, uint64_t *x, uint64_t *b) {
 
-	/* Multiply the vector x[] by the matrix A (stored
-	   columnwise) and put the result in b[]. vsize
-	   refers to the number of uint64_t's allocated for
-	   x[] and b[]; vsize is probably different from ncols */
+	/* XOR the product of columns start to stop - 1 of
+	   the matrix A with the corresponding entries of x[]
+	   into b[] */
 
 	slong i, j;
 
-	memset(b, 0, vsize * sizeof(uint64_t));
-	
-	for (i = 0; i < ncols; i++) {
+	for (i = start; i < stop; i++) {
 		la_col_t *col = A + i;
 		slong *row_entries = col->data;
 		uint64_t tmp = x[i];
@@ -499,7 +505,7 @@ void mul_MxN_Nx64(slong vsize, slong dense_rows,
 	}
 
 	if (dense_rows) {
-		for (i = 0; i < ncols; i++) {
+		for (i = start; i < stop; i++) {
 			la_col_t *col = A + i;
 			slong *row_entries = col->data + col->weight;
 			uint64_t tmp = x[i];
@@ -515,16 +521,29 @@ void mul_MxN_Nx64(slong vsize, slong dense_rows,
 }
 
 /*-------------------------------------------------------------------*/
-void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
-			la_col_t *A, uint64_t *x, uint64_t *b) {
+void mul_MxN_Nx64(slong vsize, slong dense_rows,
+		slong ncols, la_col_t *A,
+		uint64_t *x, uint64_t *b) {
 
-	/* Multiply the vector x[] by the transpose of the
-	   matrix A and put the result in b[]. Since A is stored
-	   by columns, this is just a matrix-vector product */
+	/* Multiply the vector x[] by the matrix A (stored
+	   columnwise) and put the result in b[]. vsize
+	   refers to the number of uint64_t's allocated for
+	   x[] and b[]; vsize is probably different from ncols */
+
+	memset(b, 0, vsize * sizeof(uint64_t));
+	mul_MxN_Nx64_range(dense_rows, 0, ncols, A, x, b);
+}
+
+/*-------------------------------------------------------------------*/
+static void mul_trans_MxN_Nx64_range(slong dense_rows, slong start,
+			slong stop, la_col_t *A, uint64_t *x, uint64_t *b) {
+
+	/* Set entries start to stop - 1 of b[] to the
+	   product of the corresponding columns of A with x[] */
 
 	slong i, j;
 
-	for (i = 0; i < ncols; i++) {
+	for (i = start; i < stop; i++) {
 		la_col_t *col = A + i;
 		slong *row_entries = col->data;
 		uint64_t accum = 0;
@@ -536,7 +555,7 @@ void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
 	}
 
 	if (dense_rows) {
-		for (i = 0; i < ncols; i++) {
+		for (i = start; i < stop; i++) {
 			la_col_t *col = A + i;
 			slong *row_entries = col->data + col->weight;
 			uint64_t accum = b[i];
@@ -552,6 +571,179 @@ void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
 	}
 }
 
+/*-------------------------------------------------------------------*/
+void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
+			la_col_t *A, uint64_t *x, uint64_t *b) {
+
+	/* Multiply the vector x[] by the transpose of the
+	   matrix A and put the result in b[]. Since A is stored
+	   by columns, this is just a matrix-vector product */
+
+	mul_trans_MxN_Nx64_range(dense_rows, 0, ncols, A, x, b);
+}
+
+/*-------------------------------------------------------------------*/
+/* Multithreaded versions of the products used in each iteration.
+   The work is cut into nparts contiguous pieces, one for each
+   member of the thread team block_lanczos runs in, and the pieces
+   are handed out with flint_parallel_do. Products whose result
+   is a sum over all the pieces (B*x and transpose(x)*y) are done
+   into private buffers which are XORed together afterwards. */
+
+typedef struct {
+	slong nparts;
+	slong vsize;
+	slong dense_rows;
+	slong ncols;
+	la_col_t *A;
+	uint64_t *bufs;		/* (nparts - 1) vectors of vsize words */
+	uint64_t *scratch;	/* nparts blocks of 256 * 8 + 64 words */
+
+	/* operands of the current product */
+	uint64_t *x;
+	uint64_t *y;
+	uint64_t *b;
+	slong n;
+} la_thread_t;
+
+#define LA_SCRATCH (256 * 8 + 64)
+
+#define LA_START(i, len, nparts) (((i) * (len)) / (nparts))
+
+static void mul_MxN_Nx64_worker(slong i, void *arg_ptr) {
+
+	la_thread_t *arg = (la_thread_t *) arg_ptr;
+	uint64_t *b = (i == 0) ? arg->b : arg->bufs + (i - 1) * arg->vsize;
+
+	memset(b, 0, arg->vsize * sizeof(uint64_t));
+	mul_MxN_Nx64_range(arg->dense_rows, 
+			LA_START(i, arg->ncols, arg->nparts),
+			LA_START(i + 1, arg->ncols, arg->nparts),
+			arg->A, arg->x, b);
+}
+
+static void mul_MxN_Nx64_reduce_worker(slong i, void *arg_ptr) {
+
+	la_thread_t *arg = (la_thread_t *) arg_ptr;
+	slong j, k;
+	slong start = LA_START(i, arg->vsize, arg->nparts);
+	slong stop = LA_START(i + 1, arg->vsize, arg->nparts);
+	uint64_t *b = arg->b;
+
+	for (j = 1; j < arg->nparts; j++) {
+		uint64_t *buf = arg->bufs + (j - 1) * arg->vsize;
+
+		for (k = start; k < stop; k++)
+			b[k] ^= buf[k];
+	}
+}
+
+static void mul_MxN_Nx64_threaded(la_thread_t *arg,
+				uint64_t *x, uint64_t *b) {
+
+	if (arg->nparts == 1) {
+		mul_MxN_Nx64(arg->vsize, arg->dense_rows, arg->ncols,
+				arg->A, x, b);
+		return;
+	}
+
+	arg->x = x;
+	arg->b = b;
+	flint_parallel_do(mul_MxN_Nx64_worker, arg, arg->nparts, 0,
+			FLINT_PARALLEL_UNIFORM);
+	flint_parallel_do(mul_MxN_Nx64_reduce_worker, arg, arg->nparts, 0,
+			FLINT_PARALLEL_UNIFORM);
+}
+
+static void mul_trans_MxN_Nx64_worker(slong i, void *arg_ptr) {
+
+	la_thread_t *arg = (la_thread_t *) arg_ptr;
+
+	mul_trans_MxN_Nx64_range(arg->dense_rows,
+			LA_START(i, arg->ncols, arg->nparts),
+			LA_START(i + 1, arg->ncols, arg->nparts),
+			arg->A, arg->x, arg->b);
+}
+
+static void mul_trans_MxN_Nx64_threaded(la_thread_t *arg,
+				uint64_t *x, uint64_t *b) {
+
+	if (arg->nparts == 1) {
+		mul_trans_MxN_Nx64(arg->dense_rows, arg->ncols, arg->A, x, b);
+		return;
+	}
+
+	arg->x = x;
+	arg->b = b;
+	flint_parallel_do(mul_trans_MxN_Nx64_worker, arg, arg->nparts, 0,
+			FLINT_PARALLEL_UNIFORM);
+}
+
+static void mul_64xN_Nx64_worker(slong i, void *arg_ptr) {
+
+	la_thread_t *arg = (la_thread_t *) arg_ptr;
+	slong start = LA_START(i, arg->n, arg->nparts);
+	slong stop = LA_START(i + 1, arg->n, arg->nparts);
+	uint64_t *c = arg->scratch + i * LA_SCRATCH;
+
+	mul_64xN_Nx64(arg->x + start, arg->y + start, c, c + 256 * 8,
+			stop - start);
+}
+
+static void mul_64xN_Nx64_threaded(la_thread_t *arg, uint64_t *x,
+				uint64_t *y, uint64_t *c, uint64_t *xy, slong n) {
+
+	slong i, j;
+
+	if (arg->nparts == 1) {
+		mul_64xN_Nx64(x, y, c, xy, n);
+		return;
+	}
+
+	arg->x = x;
+	arg->y = y;
+	arg->n = n;
+	flint_parallel_do(mul_64xN_Nx64_worker, arg, arg->nparts, 0,
+			FLINT_PARALLEL_UNIFORM);
+
+	memcpy(xy, arg->scratch + 256 * 8, 64 * sizeof(uint64_t));
+
+	for (i = 1; i < arg->nparts; i++) {
+		uint64_t *part = arg->scratch + i * LA_SCRATCH + 256 * 8;
+
+		for (j = 0; j < 64; j++)
+			xy[j] ^= part[j];
+	}
+}
+
+static void mul_Nx64_64x64_acc_worker(slong i, void *arg_ptr) {
+
+	la_thread_t *arg = (la_thread_t *) arg_ptr;
+	slong start = LA_START(i, arg->n, arg->nparts);
+	slong stop = LA_START(i + 1, arg->n, arg->nparts);
+
+	mul_Nx64_64x64_acc_precomp(arg->x + start, arg->y,
+			arg->b + start, stop - start);
+}
+
+static void mul_Nx64_64x64_acc_threaded(la_thread_t *arg, uint64_t *v,
+			uint64_t *x, uint64_t *c, uint64_t *y, slong n) {
+
+	if (arg->nparts == 1) {
+		mul_Nx64_64x64_acc(v, x, c, y, n);
+		return;
+	}
+
+	precompute_Nx64_64x64(x, c);
+
+	arg->x = v;
+	arg->y = c;
+	arg->b = y;
+	arg->n = n;
+	flint_parallel_do(mul_Nx64_64x64_acc_worker, arg, arg->nparts, 0,
+			FLINT_PARALLEL_UNIFORM);
+}
+
 /*-----------------------------------------------------------------------*/
 static void transpose_vector(slong ncols, uint64_t *v, uint64_t **trans) {
 
@@ -714,6 +906,7 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 	slong dim0, dim1;
 	uint64_t mask0, mask1;
 	slong vsize;
+	la_thread_t thr[1];
 
 	/* allocate all of the size-n variables. Note that because
 	   B has been preprocessed to ignore singleton rows, the
@@ -744,6 +937,25 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 	f = (uint64_t *)flint_malloc(64 * sizeof(uint64_t));
 	f2 = (uint64_t *)flint_malloc(64 * sizeof(uint64_t));
 
+	/* split the products across the current thread team,
+	   unless the matrix is too small to be worth it */
+
+	thr->nparts = thread_pool_team_size();
+	if (ncols < QS_LANCZOS_THREAD_CUTOFF)
+		thr->nparts = 1;
+	thr->vsize = vsize;
+	thr->dense_rows = dense_rows;
+	thr->ncols = ncols;
+	thr->A = B;
+	thr->bufs = NULL;
+	thr->scratch = NULL;
+	if (thr->nparts > 1) {
+		thr->bufs = (uint64_t *)flint_malloc((thr->nparts - 1) *
+					vsize * sizeof(uint64_t));
+		thr->scratch = (uint64_t *)flint_malloc(thr->nparts *
+					LA_SCRATCH * sizeof(uint64_t));
+	}
+
 	/* The iterations computes v[0], vt_a_v[0],
 	   vt_a2_v[0], s[0] and winv[0]. Subscripts larger
 	   than zero represent past versions of these
@@ -777,8 +989,8 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 #endif
 
 	memcpy(x, v[0], vsize * sizeof(uint64_t));
-	mul_MxN_Nx64(vsize, dense_rows, ncols, B, v[0], scratch);
-	mul_trans_MxN_Nx64(dense_rows, ncols, B, scratch, v[0]);
+	mul_MxN_Nx64_threaded(thr, v[0], scratch);
+	mul_trans_MxN_Nx64_threaded(thr, scratch, v[0]);
 	memcpy(v0, v[0], vsize * sizeof(uint64_t));
 
 	/* perform the iteration */
@@ -790,13 +1002,13 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 		   version of B, or B'B (apostrophe means 
 		   transpose). Use "A" to refer to B'B  */
 
-		mul_MxN_Nx64(vsize, dense_rows, ncols, B, v[0], scratch);
-		mul_trans_MxN_Nx64(dense_rows, ncols, B, scratch, vnext);
+		mul_MxN_Nx64_threaded(thr, v[0], scratch);
+		mul_trans_MxN_Nx64_threaded(thr, scratch, vnext);
 
 		/* compute v0'*A*v0 and (A*v0)'(A*v0) */
 
-		mul_64xN_Nx64(v[0], vnext, scratch, vt_a_v[0], n);
-		mul_64xN_Nx64(vnext, vnext, scratch, vt_a2_v[0], n);
+		mul_64xN_Nx64_threaded(thr, v[0], vnext, scratch, vt_a_v[0], n);
+		mul_64xN_Nx64_threaded(thr, vnext, vnext, scratch, vt_a2_v[0], n);
 
 		/* if the former is orthogonal to itself, then
 		   the iteration has finished */
@@ -863,15 +1075,15 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 		for (i = 0; i < n; i++)
 			vnext[i] = vnext[i] & mask0;
 
-		mul_Nx64_64x64_acc(v[0], d, scratch, vnext, n);
-		mul_Nx64_64x64_acc(v[1], e, scratch, vnext, n);
-		mul_Nx64_64x64_acc(v[2], f, scratch, vnext, n);
+		mul_Nx64_64x64_acc_threaded(thr, v[0], d, scratch, vnext, n);
+		mul_Nx64_64x64_acc_threaded(thr, v[1], e, scratch, vnext, n);
+		mul_Nx64_64x64_acc_threaded(thr, v[2], f, scratch, vnext, n);
 		
 		/* update the computed solution 'x' */
 
-		mul_64xN_Nx64(v[0], v0, scratch, d, n);
+		mul_64xN_Nx64_threaded(thr, v[0], v0, scratch, d, n);
 		mul_64x64_64x64(winv[0], d, d);
-		mul_Nx64_64x64_acc(v[0], d, scratch, x, n);
+		mul_Nx64_64x64_acc_threaded(thr, v[0], d, scratch, x, n);
 
 		/* rotate all the variables */
 
@@ -915,6 +1127,8 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 	flint_free(e);
 	flint_free(f);
 	flint_free(f2);
+	flint_free(thr->bufs);
+	flint_free(thr->scratch);
 
 	/* if a recoverable failure occurred, start everything
 	   over again */
@@ -23,5 +23,5 @@ void qsieve_clear(qs_t qs_inf)
     qs_inf->factor_base = NULL;
     qs_inf->sqrts       = NULL;
 
-    flint_free(qs_inf->fname);
+    qsieve_clear_relations(qs_inf);
 }
@@ -21,14 +21,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include <sys/types.h>
-#if (!defined (__WIN32) || defined(__CYGWIN__)) && !defined(_MSC_VER)
-#include <unistd.h>
-#endif
-#if defined (__WIN32) && !defined(__CYGWIN__)
-#include <windows.h>
-#endif
-
 int compare_facs(const void * a, const void * b)
 {
    fmpz * x = (fmpz *) a;
@@ -37,6 +29,28 @@ int compare_facs(const void * a, const void * b)
    return fmpz_cmp(x, y);
 }
 
+typedef struct
+{
+    flint_rand_s * state;
+    slong nrows;
+    slong ncols;
+    la_col_t * matrix;
+    uint64_t * nullrows;
+}
+_lanczos_arg_struct;
+
+/* repeat block lanczos until it succeeds */
+static void _qsieve_lanczos_worker(void * varg)
+{
+    _lanczos_arg_struct * arg = (_lanczos_arg_struct *) varg;
+
+    do
+    {
+        arg->nullrows = block_lanczos(arg->state, arg->nrows, 0,
+                                                      arg->ncols, arg->matrix);
+    } while (arg->nullrows == NULL);
+}
+
 /*
    Finds at least one nontrivial factor of n using the self initialising
    multiple polynomial quadratic sieve with single large prime variation.
@@ -55,7 +69,7 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
     fmpz_t temp, temp2, X, Y;
     slong num_facs;
     fmpz * facs;
-    int nchars;
+    _lanczos_arg_struct lanczos_arg;
 
     if (fmpz_sgn(n) < 0)
     {
@@ -201,16 +215,6 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
 #if FLINT_USES_PTHREAD
     pthread_mutex_init(&qs_inf->mutex, NULL);
 #endif
-    
-#if defined (__WIN32) && !defined(__CYGWIN__)
-    srand((int) GetCurrentProcessId());
-#else
-    srand((int) getpid());
-#endif
-    nchars = sprintf(qs_inf->fname, "%d", (int) rand());
-    strcat(qs_inf->fname + nchars, "siqs.dat");
-
-    qs_inf->siqs = fopen(qs_inf->fname, "w");
 
     for (j = qs_inf->small_primes; j < qs_inf->num_primes; j++)
     {
@@ -252,8 +256,6 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
             {
                 int ok;
 
-                fclose(qs_inf->siqs);
-
                 ok = qsieve_process_relation(qs_inf);
 
                 if (ok == -1)
@@ -293,10 +295,16 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
  
                     flint_randinit(state); /* initialise the random generator */
 
-                    do /* repeat block lanczos until it succeeds */
-                    {
-                        nullrows = block_lanczos(state, nrows, 0, ncols, qs_inf->matrix);
-                    } while (nullrows == NULL);
+                    lanczos_arg.state = state;
+                    lanczos_arg.nrows = nrows;
+                    lanczos_arg.ncols = ncols;
+                    lanczos_arg.matrix = qs_inf->matrix;
+
+                    /* the threads held for sieving share the matrix products */
+                    thread_pool_run_tasks(global_thread_pool, qs_inf->handles,
+                          qs_inf->num_handles, _qsieve_lanczos_worker, &lanczos_arg);
+
+                    nullrows = lanczos_arg.nullrows;
 
                     for (i = 0, mask = 0; i < ncols; i++) /* create mask of nullspace vectors */
                         mask |= nullrows[i];
@@ -366,7 +374,7 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
 
                     _fmpz_vec_clear(facs, 100);
 
-                    qs_inf->siqs = fopen(qs_inf->fname, "w");
+                    qsieve_clear_relations(qs_inf);
                     qs_inf->num_primes = num_primes; /* linear algebra adjusts this */
                     goto more_primes; /* factoring failed, may need more primes */
                 }
@@ -444,7 +452,6 @@ cleanup:
     flint_give_back_threads(qs_inf->handles, qs_inf->num_handles);
 
     flint_free(sieve);
-    remove(qs_inf->fname);
     qsieve_clear(qs_inf);
     qsieve_linalg_clear(qs_inf);
     qsieve_poly_clear(qs_inf);
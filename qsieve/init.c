@@ -16,7 +16,9 @@ void qsieve_init(qs_t qs_inf, const fmpz_t n)
 {
     slong i;
 
-    qs_inf->fname = (char *) flint_malloc(20); /* space for filename */
+    qs_inf->rels = NULL;
+    qs_inf->num_rels = 0;
+    qs_inf->alloc_rels = 0;
 
     /* store n in struct */
     fmpz_init_set(qs_inf->n, n);
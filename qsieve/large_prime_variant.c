@@ -10,8 +10,8 @@
     (at your option) any later version.  See <https://www.gnu.org/licenses/>.
 */
 
-#include <ctype.h>
 #include "qsieve.h"
+#include "thread_support.h"
 
 #define HASH_MULT (2654435761U)       /* hash function, taken from 'msieve' */
 #define HASH(a) ((ulong)((((unsigned int) a) * HASH_MULT) >> (12)))
@@ -88,31 +88,109 @@ int qsieve_is_relation(qs_t qs_inf, relation_t a)
     return 1;
 }
 
+/******************************************************************************
+ * 
+ *  Relation storage
+ * 
+ *****************************************************************************/
+
 /*
-    Write partial or full relation to file
+    Append a partial or full relation to the buffer of the thread owning
+    poly. The buffers are only read by qsieve_gather_relations after all
+    threads are done sieving, so no locking is required
 */
-void qsieve_write_to_file(qs_t qs_inf, mp_limb_t prime, fmpz_t Y, qs_poly_t poly)
+void qsieve_store_relation(qs_t qs_inf, qs_poly_t poly,
+                                                    mp_limb_t prime, fmpz_t Y)
 {
     slong i;
-    char * str = NULL;
-    slong num_factors = poly->num_factors;
-    slong * small = poly->small;
-    fac_t * factor = poly->factor;
+    relation_t * rel;
 
-    flint_fprintf(qs_inf->siqs, "%X ", prime); /* write large prime */
+    if (poly->num_rels == poly->alloc_rels)
+    {
+        poly->alloc_rels = FLINT_MAX(2*poly->alloc_rels, 64);
+        poly->rels = (relation_t *) flint_realloc(poly->rels,
+                                          poly->alloc_rels*sizeof(relation_t));
+    }
 
-    for (i = 0; i < qs_inf->small_primes; i++) /* write small primes */
-        flint_fprintf(qs_inf->siqs, "%X ", small[i]);
+    rel = poly->rels + poly->num_rels;
+    poly->num_rels++;
 
-    flint_fprintf(qs_inf->siqs, "%X ", num_factors); /* write number of factors */
+    rel->lp = prime;
+    rel->num_factors = poly->num_factors;
+    rel->small_primes = qs_inf->small_primes;
+    rel->small = flint_malloc(qs_inf->small_primes*sizeof(slong));
+    rel->factor = flint_malloc(FLINT_MAX(poly->num_factors, 1)*sizeof(fac_t));
 
-    for (i = 0; i < num_factors; i++) /* write factor along with exponent */
-        flint_fprintf(qs_inf->siqs, "%wx %X ", factor[i].ind, factor[i].exp);
+    for (i = 0; i < qs_inf->small_primes; i++)
+        rel->small[i] = poly->small[i];
 
-    str = fmpz_get_str(str, 16, Y); /* converting value of 'Y'  to hex */
+    for (i = 0; i < poly->num_factors; i++)
+        rel->factor[i] = poly->factor[i];
 
-    flint_fprintf(qs_inf->siqs, "%s\n", str); /* write value of 'Y' */
-    flint_free(str);
+    fmpz_init_set(rel->Y, Y);
+}
+
+/*
+    Move the relations found by each thread into the main relation store
+    and account for them in the counts of full relations and partials
+*/
+void qsieve_gather_relations(qs_t qs_inf)
+{
+    slong i, j, num = qs_inf->num_rels;
+    qs_poly_s * poly;
+
+    for (i = 0; i <= qs_inf->num_handles; i++)
+        num += qs_inf->poly[i].num_rels;
+
+    if (num > qs_inf->alloc_rels)
+    {
+        qs_inf->alloc_rels = FLINT_MAX(num, 2*qs_inf->alloc_rels);
+        qs_inf->rels = (relation_t *) flint_realloc(qs_inf->rels,
+                                        qs_inf->alloc_rels*sizeof(relation_t));
+    }
+
+    for (i = 0; i <= qs_inf->num_handles; i++)
+    {
+        poly = qs_inf->poly + i;
+
+        for (j = 0; j < poly->num_rels; j++)
+        {
+            if (poly->rels[j].lp == UWORD(1))
+            {
+                qs_inf->full_relation++;
+            }
+            else
+            {
+                qs_inf->edges++;
+                qsieve_add_to_hashtable(qs_inf, poly->rels[j].lp);
+            }
+
+            qs_inf->rels[qs_inf->num_rels++] = poly->rels[j];
+        }
+
+        poly->num_rels = 0;
+    }
+}
+
+/*
+    Discard all relations found so far
+*/
+void qsieve_clear_relations(qs_t qs_inf)
+{
+    slong i;
+
+    for (i = 0; i < qs_inf->num_rels; i++)
+    {
+        flint_free(qs_inf->rels[i].small);
+        flint_free(qs_inf->rels[i].factor);
+        fmpz_clear(qs_inf->rels[i].Y);
+    }
+
+    flint_free(qs_inf->rels);
+
+    qs_inf->rels = NULL;
+    qs_inf->num_rels = 0;
+    qs_inf->alloc_rels = 0;
 }
 
 /******************************************************************************
@@ -194,55 +272,26 @@ void qsieve_add_to_hashtable(qs_t qs_inf, mp_limb_t prime)
  *****************************************************************************/
 
 /*
-   given a string representing a relation, parse it to
-   obtain relation
+   make a copy of a stored relation, with room for max_factors factors
 */
-relation_t qsieve_parse_relation(qs_t qs_inf, char * str)
+static relation_t _qsieve_copy_relation(qs_t qs_inf, const relation_t * a)
 {
     slong i;
-    char * next;
     relation_t rel;
 
-    rel.lp = UWORD(1);
+    rel.lp = a->lp;
+    rel.num_factors = a->num_factors;
+    rel.small_primes = qs_inf->small_primes;
     rel.small = flint_malloc(qs_inf->small_primes * sizeof(slong));
     rel.factor = flint_malloc(qs_inf->max_factors * sizeof(fac_t));
 
     for (i = 0; i < qs_inf->small_primes; i++)
-    {
-        while (isspace(*str))
-            str++;
-
-        rel.small[i] = strtoul(str, &next, 16);
-        str = next;
-    }
-
-    while (isspace(*str))
-        str++;
+        rel.small[i] = a->small[i];
 
-    rel.num_factors = strtoul(str, &next, 16);
-    rel.small_primes = qs_inf->small_primes;
-    str = next;
-
-    for (i = 0; i < rel.num_factors; i++)
-    {
-        while (isspace(*str))
-            str++;
+    for (i = 0; i < a->num_factors; i++)
+        rel.factor[i] = a->factor[i];
 
-        rel.factor[i].ind = strtoul(str, &next, 16);
-        str = next;
-
-        while (isspace(*str))
-            str++;
-
-        rel.factor[i].exp = strtoul(str, &next, 16);
-        str = next;
-    }
-
-    while (isspace(*str))
-        str++;
-
-    fmpz_init(rel.Y);
-    fmpz_set_str(rel.Y, str, 16);
+    fmpz_init_set(rel.Y, a->Y);
 
     return rel;
 }
@@ -477,50 +526,66 @@ void qsieve_insert_relation(qs_t qs_inf, relation_t * rel_list, slong num_relati
 }
 
 /*
-   process relations from the file
+   merge pairs of partials with the same large prime, in parallel
+*/
+typedef struct
+{
+    qs_s * inf;
+    relation_t * rel_list;
+    relation_t * rlist;
+    slong * pairs;
+    slong num_pairs;
+}
+_merge_arg_t;
+
+static void _qsieve_merge_worker(slong k, void * varg)
+{
+    _merge_arg_t * arg = (_merge_arg_t *) varg;
+
+    arg->rlist[k] = qsieve_merge_relation(arg->inf,
+            arg->rel_list[arg->pairs[2*k]], arg->rel_list[arg->pairs[2*k + 1]]);
+}
+
+static void _qsieve_merge_all(void * varg)
+{
+    _merge_arg_t * arg = (_merge_arg_t *) varg;
+
+    flint_parallel_do(_qsieve_merge_worker, arg, arg->num_pairs, 0,
+                                                      FLINT_PARALLEL_UNIFORM);
+}
+
+/*
+   process the stored relations
 */
 int qsieve_process_relation(qs_t qs_inf)
 {
-    char buf[1024];
-    char * str;
     slong i, num_relations = 0, num_relations2, full = 0;
     slong rel_list_length;
     slong rlist_length;
+    slong num_pairs;
+    slong * pairs;
     mp_limb_t prime;
     hash_t * entry;
     mp_limb_t * hash_table = qs_inf->hash_table;
-    slong rel_size = 50000;
-    relation_t * rel_list = (relation_t *) flint_malloc(rel_size * sizeof(relation_t));
+    relation_t * rel_list = (relation_t *) flint_malloc(
+                            FLINT_MAX(qs_inf->num_rels, 1) * sizeof(relation_t));
     relation_t * rlist;
+    _merge_arg_t arg;
     int done = 0;
-  
-    qs_inf->siqs = fopen(qs_inf->fname, "r");
 
 #if QS_DEBUG & 64
     printf("Getting relations\n");
 #endif
 
-    while (fgets(buf, sizeof(buf), qs_inf->siqs) != NULL)
+    for (i = 0; i < qs_inf->num_rels; i++)
     {
-        prime = strtoul(buf, &str, 16);
+        prime = qs_inf->rels[i].lp;
         entry = qsieve_get_table_entry(qs_inf, prime);
 
-        if (num_relations == rel_size)
-        {
-           rel_list = (relation_t *) flint_realloc(rel_list, 2*rel_size * sizeof(relation_t));
-           rel_size *= 2;
-        }
-        
         if (prime == 1 || entry->count >= 2)
-        {
-            rel_list[num_relations] = qsieve_parse_relation(qs_inf, str);
-            rel_list[num_relations].lp = prime;
-            num_relations++;
-        }
+            rel_list[num_relations++] = _qsieve_copy_relation(qs_inf, qs_inf->rels + i);
     }
 
-    fclose(qs_inf->siqs);
-
 #if QS_DEBUG & 64
     printf("Removing duplicates\n");
 #endif
@@ -532,11 +597,17 @@ int qsieve_process_relation(qs_t qs_inf)
     printf("Merging relations\n");
 #endif
 
-    rlist = flint_malloc(num_relations * sizeof(relation_t));
+    rlist = flint_malloc(FLINT_MAX(num_relations, 1) * sizeof(relation_t));
+    pairs = flint_malloc(FLINT_MAX(2 * num_relations, 1) * sizeof(slong));
     memset(hash_table, 0, (1 << 20) * sizeof(mp_limb_t));
     qs_inf->vertices = 0;
 
+    /*
+       full relations sort first, so they go to the start of rlist, followed
+       by the merged partials
+    */
     rlist_length = 0;
+    num_pairs = 0;
     for (i = 0; i < num_relations; i++)
     {
         if (rel_list[i].lp == UWORD(1))
@@ -558,11 +629,25 @@ int qsieve_process_relation(qs_t qs_inf)
                    done = -1;
                    goto cleanup;
                 }
-                rlist[rlist_length++] = qsieve_merge_relation(qs_inf, rel_list[i], rel_list[entry->count]);
+
+                pairs[2*num_pairs] = i;
+                pairs[2*num_pairs + 1] = entry->count;
+                num_pairs++;
             }
         }
     }
 
+    /* the threads held for sieving do the merging */
+    arg.inf = qs_inf;
+    arg.rel_list = rel_list;
+    arg.rlist = rlist + rlist_length;
+    arg.pairs = pairs;
+    arg.num_pairs = num_pairs;
+
+    thread_pool_run_tasks(global_thread_pool, qs_inf->handles,
+                               qs_inf->num_handles, _qsieve_merge_all, &arg);
+
+    rlist_length += num_pairs;
     num_relations = rlist_length;
 
 #if QS_DEBUG & 64
@@ -573,7 +658,6 @@ int qsieve_process_relation(qs_t qs_inf)
     {
        qs_inf->edges -= 100;
        done = 0;
-       qs_inf->siqs = fopen(qs_inf->fname, "a");
     } else
     {
        done = 1;
@@ -603,7 +687,7 @@ cleanup:
        fmpz_clear(rlist[i].Y);
     }
     flint_free(rlist);
+    flint_free(pairs);
 
     return done;
 }
-
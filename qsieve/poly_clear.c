@@ -57,6 +57,7 @@ void qsieve_poly_clear(qs_t qs_inf)
       flint_free(qs_inf->poly[i].soln2);
       flint_free(qs_inf->poly[i].small);
       flint_free(qs_inf->poly[i].factor);
+      flint_free(qs_inf->poly[i].rels);
    }
    flint_free(qs_inf->poly);
 
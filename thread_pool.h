@@ -85,6 +85,34 @@ FLINT_DLL void thread_pool_give_back(thread_pool_t T, thread_pool_handle i);
 
 FLINT_DLL void thread_pool_clear(thread_pool_t T);
 
+/* work-stealing tasks *******************************************************/
+
+/*
+    Teams are tracked in thread local storage. Without it, tasks are run
+    serially by the thread spawning them.
+*/
+#define THREAD_POOL_HAVE_TASKS (FLINT_USES_PTHREAD && FLINT_USES_TLS)
+
+typedef struct
+{
+    void (* fxn)(void *);
+    void * arg;
+    volatile int state;
+} thread_pool_task_struct;
+
+typedef thread_pool_task_struct thread_pool_task_t[1];
+
+FLINT_DLL void thread_pool_run_tasks(thread_pool_t T,
+                    thread_pool_handle * handles, slong num_handles,
+                                               void (* f)(void *), void * a);
+
+FLINT_DLL slong thread_pool_team_size(void);
+
+FLINT_DLL void thread_pool_task_spawn(thread_pool_task_t t,
+                                               void (* f)(void *), void * a);
+
+FLINT_DLL void thread_pool_task_sync(thread_pool_task_t t);
+
 /* misc internal helpers *****************************************************/
 
 FLINT_DLL void _thread_pool_distribute_work_2(slong start, slong stop,
@@ -0,0 +1,314 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+#define TASK_QUEUED  0
+#define TASK_RUNNING 1
+#define TASK_DONE    2
+
+/*
+    thread_pool_task_sync tests for completion without holding the team
+    mutex, so the final store of the state is a release and the test is an
+    acquire: whatever the task wrote is visible once it is seen as done.
+    Compilers without the atomic builtins only test it with the mutex held.
+*/
+#if defined(__ATOMIC_ACQUIRE)
+#define _task_set_done(t) \
+    __atomic_store_n(&(t)->state, TASK_DONE, __ATOMIC_RELEASE)
+#define _task_is_done(t) \
+    (__atomic_load_n(&(t)->state, __ATOMIC_ACQUIRE) == TASK_DONE)
+#define _task_is_done_unlocked(t) _task_is_done(t)
+#else
+#define _task_set_done(t) ((t)->state = TASK_DONE)
+#define _task_is_done(t) ((t)->state == TASK_DONE)
+#define _task_is_done_unlocked(t) 0
+#endif
+
+#if THREAD_POOL_HAVE_TASKS
+
+/*
+    A team is the calling thread (member 0) together with the pool threads
+    whose handles were passed to thread_pool_run_tasks. Every member owns a
+    deque of spawned tasks: the owner pushes and pops at the tail, while
+    idle members steal from the head of the other deques. A single mutex
+    protects all deques; tasks are expected to be coarse enough that this
+    is not a bottleneck.
+*/
+typedef struct
+{
+    thread_pool_task_struct ** tasks;
+    slong head;
+    slong tail;
+    slong alloc;
+} _task_deque_struct;
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    _task_deque_struct * deques;
+    slong size;
+    slong queued;
+    int done;
+} _task_team_struct;
+
+typedef struct
+{
+    _task_team_struct * team;
+    slong idx;
+} _task_member_struct;
+
+static FLINT_TLS_PREFIX _task_team_struct * _task_team = NULL;
+static FLINT_TLS_PREFIX slong _task_team_idx = 0;
+
+/* the following helpers assume that team->mutex is held */
+
+static void
+_task_push(_task_team_struct * team, slong idx, thread_pool_task_struct * t)
+{
+    _task_deque_struct * Q = team->deques + idx;
+
+    if (Q->tail >= Q->alloc)
+    {
+        Q->alloc = FLINT_MAX(2 * Q->alloc, 8);
+        Q->tasks = (thread_pool_task_struct **) flint_realloc(Q->tasks,
+                                   Q->alloc * sizeof(thread_pool_task_struct *));
+    }
+
+    Q->tasks[Q->tail++] = t;
+    team->queued++;
+}
+
+static thread_pool_task_struct *
+_task_take(_task_team_struct * team, slong idx)
+{
+    slong i, j;
+    _task_deque_struct * Q;
+    thread_pool_task_struct * t;
+
+    if (team->queued == 0)
+        return NULL;
+
+    /* newest task from our own deque */
+    Q = team->deques + idx;
+    if (Q->tail > Q->head)
+    {
+        t = Q->tasks[--Q->tail];
+        goto found;
+    }
+
+    /* oldest task from somebody else */
+    for (i = 1; i < team->size; i++)
+    {
+        j = idx + i;
+        if (j >= team->size)
+            j -= team->size;
+
+        Q = team->deques + j;
+        if (Q->tail > Q->head)
+        {
+            t = Q->tasks[Q->head++];
+            goto found;
+        }
+    }
+
+    return NULL;
+
+found:
+
+    if (Q->head == Q->tail)
+        Q->head = Q->tail = 0;
+
+    team->queued--;
+    t->state = TASK_RUNNING;
+    return t;
+}
+
+/* run t with the mutex released, then mark it done and wake any waiters */
+static void
+_task_run(_task_team_struct * team, thread_pool_task_struct * t)
+{
+    pthread_mutex_unlock(&team->mutex);
+
+    t->fxn(t->arg);
+
+    pthread_mutex_lock(&team->mutex);
+    _task_set_done(t);
+    pthread_cond_broadcast(&team->cond);
+}
+
+static void
+_task_worker(void * varg)
+{
+    _task_member_struct * arg = (_task_member_struct *) varg;
+    _task_team_struct * team = arg->team;
+    thread_pool_task_struct * t;
+
+    _task_team = team;
+    _task_team_idx = arg->idx;
+
+    pthread_mutex_lock(&team->mutex);
+
+    while (!team->done)
+    {
+        t = _task_take(team, arg->idx);
+
+        if (t != NULL)
+            _task_run(team, t);
+        else
+            pthread_cond_wait(&team->cond, &team->mutex);
+    }
+
+    pthread_mutex_unlock(&team->mutex);
+
+    _task_team = NULL;
+    _task_team_idx = 0;
+}
+
+void thread_pool_run_tasks(thread_pool_t T, thread_pool_handle * handles,
+                          slong num_handles, void (* f)(void *), void * a)
+{
+    slong i;
+    _task_team_struct team[1];
+    _task_member_struct * members;
+
+    /* already part of a team: the existing members will pick up our tasks */
+    if (_task_team != NULL || num_handles <= 0)
+    {
+        f(a);
+        return;
+    }
+
+    pthread_mutex_init(&team->mutex, NULL);
+    pthread_cond_init(&team->cond, NULL);
+    team->size = num_handles + 1;
+    team->queued = 0;
+    team->done = 0;
+    team->deques = (_task_deque_struct *) flint_calloc(team->size,
+                                                   sizeof(_task_deque_struct));
+    members = (_task_member_struct *) flint_malloc(num_handles *
+                                                  sizeof(_task_member_struct));
+
+    for (i = 0; i < num_handles; i++)
+    {
+        members[i].team = team;
+        members[i].idx = i + 1;
+        thread_pool_wake(T, handles[i], 0, _task_worker, members + i);
+    }
+
+    _task_team = team;
+    _task_team_idx = 0;
+
+    f(a);
+
+    _task_team = NULL;
+
+    pthread_mutex_lock(&team->mutex);
+    FLINT_ASSERT(team->queued == 0);
+    team->done = 1;
+    pthread_cond_broadcast(&team->cond);
+    pthread_mutex_unlock(&team->mutex);
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wait(T, handles[i]);
+
+    for (i = 0; i < team->size; i++)
+        flint_free(team->deques[i].tasks);
+
+    flint_free(team->deques);
+    flint_free(members);
+    pthread_cond_destroy(&team->cond);
+    pthread_mutex_destroy(&team->mutex);
+}
+
+slong thread_pool_team_size(void)
+{
+    return (_task_team == NULL) ? 1 : _task_team->size;
+}
+
+void thread_pool_task_spawn(thread_pool_task_t t, void (* f)(void *), void * a)
+{
+    _task_team_struct * team = _task_team;
+
+    t->fxn = f;
+    t->arg = a;
+
+    if (team == NULL)
+    {
+        t->state = TASK_RUNNING;
+        f(a);
+        _task_set_done(t);
+        return;
+    }
+
+    pthread_mutex_lock(&team->mutex);
+    t->state = TASK_QUEUED;
+    _task_push(team, _task_team_idx, t);
+    pthread_cond_signal(&team->cond);
+    pthread_mutex_unlock(&team->mutex);
+}
+
+void thread_pool_task_sync(thread_pool_task_t t)
+{
+    _task_team_struct * team = _task_team;
+    thread_pool_task_struct * s;
+
+    if (team == NULL || _task_is_done_unlocked(t))
+        return;
+
+    /*
+        Until t is finished, keep busy with other queued tasks. In the common
+        case t is still at the tail of our own deque and is simply run here.
+    */
+    pthread_mutex_lock(&team->mutex);
+
+    while (!_task_is_done(t))
+    {
+        s = _task_take(team, _task_team_idx);
+
+        if (s != NULL)
+            _task_run(team, s);
+        else
+            pthread_cond_wait(&team->cond, &team->mutex);
+    }
+
+    pthread_mutex_unlock(&team->mutex);
+}
+
+#else
+
+void thread_pool_run_tasks(thread_pool_t T, thread_pool_handle * handles,
+                          slong num_handles, void (* f)(void *), void * a)
+{
+    f(a);
+}
+
+slong thread_pool_team_size(void)
+{
+    return 1;
+}
+
+void thread_pool_task_spawn(thread_pool_task_t t, void (* f)(void *), void * a)
+{
+    t->fxn = f;
+    t->arg = a;
+    t->state = TASK_RUNNING;
+    f(a);
+    _task_set_done(t);
+}
+
+void thread_pool_task_sync(thread_pool_task_t t)
+{
+    FLINT_ASSERT(_task_is_done(t));
+}
+
+#endif
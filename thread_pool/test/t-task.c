@@ -0,0 +1,152 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "thread_pool.h"
+#include "thread_support.h"
+#include "fmpz.h"
+
+/* x = product of numbers in (min, max], splitting with spawn/sync */
+
+typedef struct
+{
+    ulong min;
+    ulong max;
+    fmpz_t ans;
+}
+fac_arg_struct;
+
+void fac_worker(void * varg)
+{
+    fac_arg_struct * arg = (fac_arg_struct *) varg;
+    ulong i;
+
+    if (arg->max - arg->min > UWORD(20))
+    {
+        fac_arg_struct left, right;
+        thread_pool_task_t task;
+
+        left.min = arg->min;
+        left.max = arg->min + (arg->max - arg->min) / 2;
+        right.min = left.max;
+        right.max = arg->max;
+        fmpz_init(left.ans);
+        fmpz_init(right.ans);
+
+        thread_pool_task_spawn(task, fac_worker, &right);
+        fac_worker(&left);
+        thread_pool_task_sync(task);
+
+        fmpz_mul(arg->ans, left.ans, right.ans);
+        fmpz_clear(left.ans);
+        fmpz_clear(right.ans);
+    }
+    else
+    {
+        fmpz_one(arg->ans);
+        for (i = arg->max; i > arg->min; i--)
+            fmpz_mul_ui(arg->ans, arg->ans, i);
+    }
+}
+
+/* nested parallel_do: res[i*m + j] = i*j */
+
+typedef struct
+{
+    slong * res;
+    slong i;
+    slong m;
+}
+inner_arg_struct;
+
+void inner(slong j, void * varg)
+{
+    inner_arg_struct * arg = (inner_arg_struct *) varg;
+
+    arg->res[arg->i * arg->m + j] = arg->i * j;
+}
+
+void outer(slong i, void * varg)
+{
+    inner_arg_struct arg = *((inner_arg_struct *) varg);
+
+    arg.i = i;
+    flint_parallel_do(inner, &arg, arg.m, 0, FLINT_PARALLEL_DYNAMIC);
+}
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("task....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        fac_arg_struct arg;
+        thread_pool_handle * handles;
+        slong num_handles, i, n, m;
+        inner_arg_struct iarg;
+        fmpz_t y;
+
+        flint_set_num_threads(n_randint(state, 10) + 1);
+
+        /* spawn/sync inside a team */
+        arg.min = 0;
+        arg.max = n_randint(state, 2000);
+        fmpz_init(arg.ans);
+        fmpz_init(y);
+
+        num_handles = flint_request_threads(&handles, WORD_MAX);
+        thread_pool_run_tasks(global_thread_pool, handles, num_handles,
+                                                              fac_worker, &arg);
+        flint_give_back_threads(handles, num_handles);
+
+        fmpz_fac_ui(y, arg.max);
+        if (!fmpz_equal(arg.ans, y))
+        {
+            flint_printf("FAIL (spawn/sync)\n");
+            flint_printf("n = %wu, num_threads = %d\n", arg.max, flint_get_num_threads());
+            flint_abort();
+        }
+
+        fmpz_clear(arg.ans);
+        fmpz_clear(y);
+
+        /* nested parallel_do */
+        n = n_randint(state, 50);
+        m = n_randint(state, 50);
+        iarg.res = flint_malloc((n * m + 1) * sizeof(slong));
+        iarg.m = m;
+        iarg.i = 0;
+
+        flint_parallel_do(outer, &iarg, n, 0, FLINT_PARALLEL_UNIFORM);
+
+        for (i = 0; i < n * m; i++)
+        {
+            if (iarg.res[i] != (i / m) * (i % m))
+            {
+                flint_printf("FAIL (nested parallel_do)\n");
+                flint_printf("n = %wd, m = %wd, i = %wd\n", n, m, i);
+                flint_abort();
+            }
+        }
+
+        flint_free(iarg.res);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -123,6 +123,274 @@ void flint_give_back_threads(thread_pool_handle * handles, slong num_handles)
         flint_free(handles);
 }
 
+#if THREAD_POOL_HAVE_TASKS
+
+/*
+    The index range [0, n) is cut into num_parts parts, which are then handed
+    out by recursive halving through thread_pool_task_spawn, so that idle
+    members of the team can steal the larger halves.
+*/
+typedef struct
+{
+    do_func_t f;
+    void * args;
+    slong n;
+    slong num_parts;
+    slong part_size;
+    slong pa;
+    slong pb;
+    int flags;
+}
+work_chunk_t;
+
+static void
+worker(void * _work)
+{
+    work_chunk_t * work = (work_chunk_t *) _work;
+    slong i, j;
+
+    if (work->pb - work->pa > 1)
+    {
+        work_chunk_t right = *work;
+        thread_pool_task_t task;
+
+        right.pa = work->pa + (work->pb - work->pa) / 2;
+        work->pb = right.pa;
+
+        thread_pool_task_spawn(task, worker, &right);
+        worker(work);
+        thread_pool_task_sync(task);
+        return;
+    }
+
+    for (j = work->pa; j < work->pb; j++)
+    {
+        if (work->flags & FLINT_PARALLEL_STRIDED)
+        {
+            for (i = j; i < work->n; i += work->num_parts)
+                work->f(i, work->args);
+        }
+        else
+        {
+            for (i = j * work->part_size;
+                    i < FLINT_MIN((j + 1) * work->part_size, work->n); i++)
+                work->f(i, work->args);
+        }
+    }
+}
+
+void flint_parallel_do(do_func_t f, void * args, slong n, int thread_limit, int flags)
+{
+    slong i, team_size, num_threads, num_workers;
+    thread_pool_handle * handles;
+    work_chunk_t work;
+
+    /* inside a parallel region: spread the work over the existing team */
+    team_size = thread_pool_team_size();
+
+    if (team_size > 1)
+    {
+        num_threads = (thread_limit <= 0) ? team_size : thread_limit;
+        num_workers = 0;
+        handles = NULL;
+    }
+    else
+    {
+        if (thread_limit <= 0)
+            thread_limit = flint_get_num_threads();
+
+        thread_limit = FLINT_MIN(thread_limit, n);
+
+        if (thread_limit <= 1)
+            num_workers = 0, handles = NULL;
+        else
+            num_workers = flint_request_threads(&handles, thread_limit);
+
+        num_threads = num_workers + 1;
+    }
+
+    num_threads = FLINT_MIN(num_threads, n);
+
+    if (flags & FLINT_PARALLEL_VERBOSE)
+        flint_printf("parallel_do with num_threads = %wd\n", num_threads);
+
+    if (num_threads <= 1)
+    {
+        flint_give_back_threads(handles, num_workers);
+
+        for (i = 0; i < n; i++)
+            f(i, args);
+
+        return;
+    }
+
+    work.f = f;
+    work.args = args;
+    work.n = n;
+    work.flags = flags;
+
+    /* with dynamic scheduling, use finer parts to give stealing some slack */
+    work.num_parts = num_threads;
+    if (flags & FLINT_PARALLEL_DYNAMIC)
+        work.num_parts = FLINT_MIN(4 * num_threads, n);
+
+    work.part_size = (n + work.num_parts - 1) / work.num_parts;
+    work.pa = 0;
+    work.pb = work.num_parts;
+
+    if (flags & FLINT_PARALLEL_VERBOSE)
+        flint_printf("%wd parts of size %wd\n", work.num_parts,
+                    (flags & FLINT_PARALLEL_STRIDED) ? 0 : work.part_size);
+
+    if (team_size > 1)
+        worker(&work);
+    else
+        thread_pool_run_tasks(global_thread_pool, handles, num_workers,
+                                                              worker, &work);
+
+    flint_give_back_threads(handles, num_workers);
+}
+
+typedef struct
+{
+    void * res;
+    bsplit_basecase_func_t basecase;
+    bsplit_merge_func_t merge;
+    size_t sizeof_res;
+    bsplit_init_func_t init;
+    bsplit_clear_func_t clear;
+    void * args;
+    slong a;
+    slong b;
+    slong basecase_cutoff;
+    slong thread_limit;
+    int flags;
+}
+flint_parallel_binary_splitting_t;
+
+/*
+    The right half is spawned as a task, with thread_limit / 2 of the threads
+    available to this call; once a single thread is left, both halves are
+    done here. This is serial outside a team.
+*/
+static void
+_bsplit_worker(void * _args)
+{
+    flint_parallel_binary_splitting_t * args = (flint_parallel_binary_splitting_t *) _args;
+    flint_parallel_binary_splitting_t left_args, right_args;
+    thread_pool_task_t task;
+    void * left, * right;
+    size_t sizeof_res = args->sizeof_res;
+    TMP_INIT;
+
+    if (args->b - args->a <= args->basecase_cutoff)
+    {
+        args->basecase(args->res, args->a, args->b, args->args);
+        return;
+    }
+
+    TMP_START;
+
+    if (args->flags & FLINT_PARALLEL_BSPLIT_LEFT_INPLACE)
+    {
+        left = args->res;
+        right = TMP_ALLOC(sizeof_res);
+
+        args->init(right, args->args);
+    }
+    else
+    {
+        left = TMP_ALLOC(2 * sizeof_res);
+        right = (void *) (((char *) left) + sizeof_res);
+
+        args->init(left, args->args);
+        args->init(right, args->args);
+    }
+
+    left_args = *args;
+    right_args = *args;
+    left_args.res = left;
+    left_args.b = args->a + (args->b - args->a) / 2;
+    right_args.res = right;
+    right_args.a = left_args.b;
+
+    if (args->thread_limit > 1)
+    {
+        left_args.thread_limit = args->thread_limit - args->thread_limit / 2;
+        right_args.thread_limit = args->thread_limit / 2;
+
+        thread_pool_task_spawn(task, _bsplit_worker, &right_args);
+        _bsplit_worker(&left_args);
+        thread_pool_task_sync(task);
+    }
+    else
+    {
+        _bsplit_worker(&left_args);
+        _bsplit_worker(&right_args);
+    }
+
+    args->merge(args->res, left, right, args->args);
+
+    if (args->flags & FLINT_PARALLEL_BSPLIT_LEFT_INPLACE)
+    {
+        args->clear(right, args->args);
+    }
+    else
+    {
+        args->clear(left, args->args);
+        args->clear(right, args->args);
+    }
+
+    TMP_END;
+}
+
+void
+flint_parallel_binary_splitting(void * res, bsplit_basecase_func_t basecase, bsplit_merge_func_t merge,
+    size_t sizeof_res, bsplit_init_func_t init, bsplit_clear_func_t clear, void * args, slong a, slong b, slong basecase_cutoff, int thread_limit, int flags)
+{
+    flint_parallel_binary_splitting_t bsplit_args;
+    thread_pool_handle * threads = NULL;
+    slong nw = 0, team_size;
+
+    basecase_cutoff = FLINT_MAX(basecase_cutoff, 1);
+
+    bsplit_args.res = res;
+    bsplit_args.basecase = basecase;
+    bsplit_args.merge = merge;
+    bsplit_args.sizeof_res = sizeof_res;
+    bsplit_args.init = init;
+    bsplit_args.clear = clear;
+    bsplit_args.args = args;
+    bsplit_args.a = a;
+    bsplit_args.b = b;
+    bsplit_args.basecase_cutoff = basecase_cutoff;
+    bsplit_args.flags = flags;
+
+    team_size = thread_pool_team_size();
+
+    /* inside a parallel region the default is the whole team */
+    if (thread_limit <= 0)
+        thread_limit = (team_size > 1) ? team_size : flint_get_num_threads();
+
+    /* there are at most (b - a) / basecase_cutoff leaves to work on */
+    thread_limit = FLINT_MIN(thread_limit, (b - a + basecase_cutoff - 1) / basecase_cutoff);
+    bsplit_args.thread_limit = thread_limit;
+
+    if (team_size == 1 && thread_limit > 1)
+        nw = flint_request_threads(&threads, thread_limit);
+
+    thread_pool_run_tasks(global_thread_pool, threads, nw, _bsplit_worker, &bsplit_args);
+
+    flint_give_back_threads(threads, nw);
+}
+
+#else
+
+/*
+    Without tasks, the work is split up front between the threads that can
+    be requested from the pool.
+*/
+
 typedef struct
 {
     do_func_t f;
@@ -351,3 +619,5 @@ flint_parallel_binary_splitting(void * res, bsplit_basecase_func_t basecase, bsp
         TMP_END;
     }
 }
+
+#endif